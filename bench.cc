@@ -0,0 +1,850 @@
+
+#include <cstdio>
+#include <cstddef>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include "image.h"
+#include "decoder.h"
+#include "listing.h"
+#include "binary.h"
+#include "flow.h"
+#include "classify.h"
+#include "signature.h"
+#include "interpreter.h"
+
+// each phase is repeated until it has run for at least this long
+static constexpr double minPhaseSeconds = 0.5;
+
+using Clock = std::chrono::steady_clock;
+
+struct Dataset
+{
+	const char* name;
+	ImageView view;
+};
+
+struct PhaseResult
+{
+	uint64_t words{};
+	uint64_t outputBytes{};
+	double seconds{};
+};
+
+template <typename Body>
+static PhaseResult runPhase(size_t wordCount, Body&& body)
+{
+	PhaseResult result;
+	const auto start = Clock::now();
+
+	do
+	{
+		result.outputBytes += body();
+		result.words += wordCount;
+		result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	}
+	while (result.seconds < minPhaseSeconds);
+
+	return result;
+}
+
+static void printPhase(const char* dataset, const char* phase, const PhaseResult& result)
+{
+	const double wordsPerSecond = result.words / result.seconds;
+
+	printf("%-10s %-14s %10.1f Mhw/s %8.2f ns/inst", dataset, phase, wordsPerSecond / 1e6, 1e9 / wordsPerSecond);
+
+	if (result.outputBytes)
+		printf(" %8.1f MB/s out", result.outputBytes / result.seconds / 1e6);
+
+	printf("\n");
+}
+
+static void benchDataset(const Dataset& dataset)
+{
+	const auto words = dataset.view.words;
+	std::vector<uint16_t> opIds(words.size());
+
+	const auto decodeOnly = runPhase(words.size(), [&]
+	{
+		Decoder::decodeBatch(words.data(), words.size(), opIds.data());
+		return 0;
+	});
+
+	printPhase(dataset.name, "decode", decodeOnly);
+
+	std::vector<DecodedInst> decoded(words.size());
+
+	const auto decodePacked = runPhase(words.size(), [&]
+	{
+		Decoder::decode(words, decoded);
+		return 0;
+	});
+
+	printPhase(dataset.name, "decode packed", decodePacked);
+
+	// formatted a chunk at a time like the real listing so the text stays in cache
+	const CodeDataMap codeData;
+	std::string out;
+	out.reserve(listingChunkWords * 64);
+
+	const auto decodeFormat = runPhase(words.size(), [&]
+	{
+		size_t bytes = 0;
+
+		for (size_t first = 0; first < words.size(); first += listingChunkWords)
+		{
+			out.clear();
+			appendListing(out, dataset.view, codeData, dataset.view.offset + first * 2, std::min(listingChunkWords, words.size() - first));
+			bytes += out.size();
+		}
+
+		return bytes;
+	});
+
+	printPhase(dataset.name, "decode+format", decodeFormat);
+}
+
+// a counting loop (add, dt, bf) for how many instructions a second the interpreter runs
+static void benchInterpreter()
+{
+	const uint16_t loop[]
+	{
+		0xE000,	// mov #0,r0
+		0xD503,	// mov.l @(3,pc),r5
+		0x305C,	// add r5,r0
+		0x4510,	// dt r5
+		0x8BFC,	// bf -4
+		0x000B,	// rts
+		0x0009,	// nop
+		0x0009,
+		0x0000, 0x0100,	// .long 0x01000000
+	};
+
+	constexpr uint64_t stepsPerRun = 1'000'000;
+
+	Interpreter interpreter;
+	interpreter.load(0x8C010000, loop, sizeof(loop));
+
+	const auto result = runPhase(stepsPerRun, [&]
+	{
+		interpreter.PC = 0x8C010000;
+		interpreter.run(stepsPerRun);
+		return 0;
+	});
+
+	printPhase("loop", "interpret", result);
+}
+
+// the listing every possible opcode produces, laid out as an image of 0x0000 - 0xFFFF
+static std::string listAllOpcodes(const ImageView& view)
+{
+	std::string out;
+	appendListing(out, view, {}, 0, view.words.size());
+	return out;
+}
+
+static bool writeGolden(const std::string& path, const std::string& listing)
+{
+	FILE* file = fopen(path.c_str(), "wb");
+
+	if (!file)
+	{
+		fprintf(stderr, "couldn't open '%s' for writing\n", path.c_str());
+		return false;
+	}
+
+	fwrite(listing.data(), 1, listing.size(), file);
+	fclose(file);
+
+	printf("wrote %zu bytes of reference listing to '%s'\n", listing.size(), path.c_str());
+	return true;
+}
+
+// compares line by line so a failure says which opcode changed
+static bool checkGolden(const std::string& path, const std::string& listing)
+{
+	const MappedFile golden(path);
+
+	if (!golden.isValid())
+	{
+		fprintf(stderr, "couldn't open reference listing '%s'\n", path.c_str());
+		return false;
+	}
+
+	const std::string_view expected(reinterpret_cast<const char*>(golden.data), size_t(golden.size));
+	const std::string_view actual(listing);
+
+	size_t expectedLine = 0;
+	size_t actualLine = 0;
+	size_t mismatches = 0;
+	size_t opcode = 0;
+
+	while (expectedLine < expected.size() || actualLine < actual.size())
+	{
+		const auto expectedEnd = std::min(expected.find('\n', expectedLine), expected.size());
+		const auto actualEnd = std::min(actual.find('\n', actualLine), actual.size());
+
+		auto a = expected.substr(expectedLine, expectedEnd - expectedLine);
+
+		// the reference may have been checked out with windows line endings
+		if (!a.empty() && a.back() == '\r')
+			a.remove_suffix(1);
+
+		const auto b = actual.substr(actualLine, actualEnd - actualLine);
+
+		if (a != b && mismatches++ < 16)
+		{
+			fprintf(stderr, "opcode 0x%04zX:\n  expected: %.*s\n  actual:   %.*s\n", opcode,
+				int(a.size()), a.data(), int(b.size()), b.data());
+		}
+
+		expectedLine = expectedEnd + 1;
+		actualLine = actualEnd + 1;
+		opcode++;
+	}
+
+	if (mismatches)
+	{
+		fprintf(stderr, "golden: %zu of %zu opcodes differ from '%s'\n", mismatches, opcode, path.c_str());
+		return false;
+	}
+
+	printf("golden: all %zu opcodes match '%s'\n", opcode, path.c_str());
+	return true;
+}
+
+// writes every opcode as a binary listing and reads it back, every record has
+// to be found with the right word, flags and text, and cutting the file short
+// anywhere has to make open() fail
+static bool checkBinaryListing(const ImageView& view)
+{
+	CodeDataMap codeData;
+	codeData.dataWords.resize(view.words.size());
+
+	for (size_t i = 0; i < view.words.size(); i += 7)
+		codeData.dataWords[i] = true;
+
+	// added out of order, the writer sorts them
+	const size_t half = view.words.size() / 2;
+	BinaryListingWriter writer;
+	writer.add(view, codeData, view.offset + half * 2, view.words.size() - half, BinaryRecord::Function);
+	writer.add(view, codeData, view.offset, half);
+
+	FILE* file = tmpfile();
+	std::vector<uint8_t> bytes;
+
+	if (file && writer.write(file))
+	{
+		bytes.resize(size_t(ftell(file)));
+		rewind(file);
+
+		if (fread(bytes.data(), 1, bytes.size(), file) != bytes.size())
+			bytes.clear();
+	}
+
+	if (file)
+		fclose(file);
+
+	BinaryListing listing;
+
+	if (bytes.empty() || !listing.open(bytes.data(), bytes.size()))
+	{
+		fprintf(stderr, "binary: couldn't write and open a listing\n");
+		return false;
+	}
+
+	size_t mismatches{};
+	char expected[128]{};
+	char actual[128]{};
+
+	for (size_t i = 0; i < view.words.size(); i++)
+	{
+		const auto address = uint32_t(view.getAddress(view.offset + i * 2));
+		const auto* record = listing.find(address);
+		const uint16_t flags = (codeData.isData(i) ? BinaryRecord::Data : 0) | (i == half ? BinaryRecord::Function : 0);
+
+		if (record)
+		{
+			Decoder::format(Decoder::decodedTable[view.words[i]], expected, sizeof(expected));
+			snprintf(actual, sizeof(actual), listing.getDecodeString(*record),
+				unsigned(record->inst.field0), unsigned(record->inst.field1), unsigned(record->inst.field2), unsigned(record->inst.field3));
+		}
+
+		if ((!record || record->word != view.words[i] || record->flags != flags || strcmp(expected, actual) || listing.find(address + 1)) && mismatches++ < 16)
+			fprintf(stderr, "binary: record for 0x%08X doesn't match\n", address);
+	}
+
+	const auto last = uint32_t(view.getAddress(view.offset + view.words.size() * 2));
+
+	if (listing.find(last) || listing.find(uint32_t(view.getAddress(view.offset)) - 2))
+	{
+		fprintf(stderr, "binary: found a record outside the listing\n");
+		mismatches++;
+	}
+
+	for (uint64_t size = 0; size < bytes.size(); size += size < listing.header->recordsOffset + 64 ? 1 : 4093)
+	{
+		if (BinaryListing cut; cut.open(bytes.data(), size))
+		{
+			fprintf(stderr, "binary: opened a listing cut short at %llu of %zu bytes\n", (unsigned long long)size, bytes.size());
+			mismatches++;
+			break;
+		}
+	}
+
+	if (mismatches)
+	{
+		fprintf(stderr, "binary: %zu problems reading back the listing\n", mismatches);
+		return false;
+	}
+
+	printf("binary: all %zu records read back\n", view.words.size());
+	return true;
+}
+
+static uint32_t nextRandom(uint32_t& seed)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+
+	return seed;
+}
+
+// one instruction of the made up code below for word 'index'. branches stay
+// within a hundred words either way and calls go to one of the nearby functions
+static uint16_t randomInstruction(uint32_t& seed, size_t index, size_t wordCount, const std::vector<size_t>& functions)
+{
+	const auto roll = nextRandom(seed) % 200;
+	const auto target = std::clamp<int64_t>(int64_t(index) + int64_t(nextRandom(seed) % 200) - 100, 0, int64_t(wordCount) - 1);
+	const auto disp = target - int64_t(index) - 2;
+	const auto reg = nextRandom(seed) % 8;
+
+	if (roll < 16)
+		return uint16_t(0x8900 | (nextRandom(seed) % 4) << 9 | (disp & 0xFF));	// bt, bf, bt/s, bf/s
+
+	if (roll < 20)
+		return uint16_t(0xA000 | (disp & 0xFFF));	// bra
+
+	if (roll < 36)
+	{
+		const auto near = size_t(std::upper_bound(functions.begin(), functions.end(), index) - functions.begin());
+		const auto function = functions[std::min(functions.size() - 1, near + nextRandom(seed) % 6 - std::min<size_t>(near, 3))];
+		const auto callDisp = int64_t(function) - int64_t(index) - 2;
+
+		if (callDisp >= -2048 && callDisp < 2048)
+			return uint16_t(0xB000 | (callDisp & 0xFFF));	// bsr
+	}
+
+	if (roll < 37)
+		return 0x000B;	// rts
+
+	if (roll < 39)
+		return uint16_t(0x400B | reg << 8);	// jsr @rn
+
+	if (roll < 52)
+		return 0x0009;	// nop
+
+	const uint16_t straight[]{ 0x6003, 0x7001, 0xD001, 0xE000, 0x300C, 0x3000, 0x2008, 0x6012 };
+	return uint16_t(straight[nextRandom(seed) % 8] | reg << 8);
+}
+
+// functions that branch around inside themselves and call their neighbours,
+// each ending in rts with a few words of literal pool after it
+static std::vector<uint16_t> buildCodeImage(size_t wordCount, uint32_t& seed, std::vector<size_t>& functions)
+{
+	for (size_t start = 0; start + 16 < wordCount; start += 16 + nextRandom(seed) % 200)
+		functions.push_back(start);
+
+	std::vector<uint16_t> words(wordCount);
+
+	for (size_t f = 0; f < functions.size(); f++)
+	{
+		const auto last = f + 1 < functions.size() ? functions[f + 1] : wordCount;
+		const auto end = last - 2 - nextRandom(seed) % 8;
+
+		for (auto i = functions[f]; i < end; i++)
+			words[i] = randomInstruction(seed, i, wordCount, functions);
+
+		words[end] = 0x000B;
+		words[end + 1] = 0x0009;
+
+		for (auto i = end + 2; i < last; i++)
+			words[i] = uint16_t(nextRandom(seed));
+	}
+
+	return words;
+}
+
+static bool isSameGraph(const FlowGraph& a, const FlowGraph& b)
+{
+	if (a.visited != b.visited || a.functions != b.functions || a.blocks.size() != b.blocks.size())
+		return false;
+
+	for (size_t i = 0; i < a.blocks.size(); i++)
+	{
+		const auto& x = a.blocks[i];
+		const auto& y = b.blocks[i];
+
+		if (x.start != y.start || x.end != y.end || x.successorCount != y.successorCount)
+			return false;
+
+		for (int s = 0; s < x.successorCount; s++)
+			if (x.successors[s] != y.successors[s])
+				return false;
+	}
+
+	return true;
+}
+
+// patches a made up image over and over and traces it through a cache file
+// every time, which has to give exactly what tracing it from scratch does
+static bool checkAnalysisCache()
+{
+	const char* path = "decompsh_bench.cache";
+	constexpr int rounds = 100;
+
+	uint32_t seed = 0x6C078965;
+	std::vector<size_t> functions;
+	auto words = buildCodeImage(64 * 1024, seed, functions);
+	const ImageView view{ words, 0, 0x8C010000 };
+	std::vector<uint64_t> entries{ 0, functions[functions.size() / 2] * 2 };
+	size_t mismatches{};
+	size_t blocks{};
+
+	remove(path);
+
+	for (int round = 0; round < rounds; round++)
+	{
+		// a few words in one to three places, every tenth round nothing so the
+		// stored graph gets used as is and now and then another entry point
+		const auto patches = round % 10 == 9 ? 0 : 1 + nextRandom(seed) % 3;
+
+		for (uint32_t patch = 0; patch < patches; patch++)
+		{
+			const auto first = nextRandom(seed) % words.size();
+			const auto count = 1 + nextRandom(seed) % 4;
+
+			for (auto i = first; i < std::min<size_t>(first + count, words.size()); i++)
+				words[i] = randomInstruction(seed, i, words.size(), functions);
+		}
+
+		if (round % 50 == 49)
+			entries.push_back(functions[nextRandom(seed) % functions.size()] * 2);
+
+		const auto cached = traceFlowCached(view, entries, path);
+		const auto traced = traceFlow(view, decodeView(view), entries);
+
+		if (!isSameGraph(cached, traced) && mismatches++ < 16)
+			fprintf(stderr, "cache: round %d traced %zu blocks with the cache and %zu without\n", round, cached.blocks.size(), traced.blocks.size());
+
+		blocks += traced.blocks.size();
+	}
+
+	if (mismatches)
+	{
+		remove(path);
+		fprintf(stderr, "cache: %zu of %d patched images traced differently with the cache\n", mismatches, rounds);
+		return false;
+	}
+
+	// a file cut short or with counts and blocks that don't fit the image has
+	// to be thrown away and traced again, not trusted
+	const auto traced = traceFlow(view, decodeView(view), entries);
+	std::vector<uint8_t> saved;
+
+	if (auto* file = fopen(path, "rb"))
+	{
+		uint8_t buffer[4096];
+		size_t size{};
+
+		while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+			saved.insert(saved.end(), buffer, buffer + size);
+
+		fclose(file);
+	}
+
+	auto checkDamaged = [&](const std::vector<uint8_t>& bytes, const char* what)
+	{
+		if (auto* file = fopen(path, "wb"))
+		{
+			fwrite(bytes.data(), 1, bytes.size(), file);
+			fclose(file);
+		}
+
+		if (!isSameGraph(traceFlowCached(view, entries, path), traced) && mismatches++ < 16)
+			fprintf(stderr, "cache: trusted a cache %s\n", what);
+	};
+
+	auto poke = [&](size_t offset, auto value)
+	{
+		auto bytes = saved;
+		memcpy(bytes.data() + offset, &value, sizeof(value));
+		return bytes;
+	};
+
+	using Header = AnalysisCache::Header;
+	const auto firstBlock = sizeof(Header) + entries.size() * sizeof(uint64_t);
+
+	for (size_t size = 0; size < saved.size(); size += size < sizeof(Header) ? 1 : 9973)
+		checkDamaged({ saved.begin(), saved.begin() + ptrdiff_t(size) }, "cut short");
+
+	checkDamaged(poke(offsetof(Header, wordCount), uint64_t(1) << 40), "for a bigger image");
+	checkDamaged(poke(offsetof(Header, entryCount), UINT32_MAX), "with too many entries");
+	checkDamaged(poke(offsetof(Header, blockCount), UINT64_MAX / 8), "with too many blocks");
+	checkDamaged(poke(offsetof(Header, functionCount), uint64_t(1) << 40), "with too many functions");
+	checkDamaged(poke(firstBlock + offsetof(Block, start), view.offset + 1), "with a block between words");
+	checkDamaged(poke(firstBlock + offsetof(Block, end), UINT64_MAX - 1), "with a block past the image");
+	checkDamaged(poke(firstBlock + offsetof(Block, successorCount), 3), "with three successors");
+
+	remove(path);
+
+	if (mismatches)
+	{
+		fprintf(stderr, "cache: %zu damaged cache files were trusted\n", mismatches);
+		return false;
+	}
+
+	printf("cache: all %d patched images traced the same with the cache, %zu blocks each on average\n", rounds, blocks / rounds);
+	return true;
+}
+
+// an image made up of whole windows of code, fill, nop runs and random bytes
+// has to come out as data everywhere but the code. the vector counts have to
+// agree with the scalar ones on every window too
+static bool checkClassifier()
+{
+	uint32_t seed = 0x2F6B6F5B;
+	std::vector<size_t> functions;
+	const auto code = buildCodeImage(16 * classifyWindowWords, seed, functions);
+	size_t codeUsed{};
+
+	std::vector<uint16_t> words;
+	std::vector<bool> expected;
+	std::vector<const char*> kinds;
+
+	auto add = [&](const char* kind, bool data, size_t windows, auto&& getWord)
+	{
+		for (size_t w = 0; w < windows; w++)
+		{
+			for (size_t i = 0; i < classifyWindowWords; i++)
+				words.push_back(getWord());
+
+			expected.push_back(data);
+			kinds.push_back(kind);
+		}
+	};
+
+	auto nextCode = [&] { return code[codeUsed++]; };
+	auto nextWord = [&] { return uint16_t(nextRandom(seed)); };
+
+	add("code", false, 4, nextCode);
+	add("0xFFFF fill", true, 2, [] { return uint16_t(0xFFFF); });
+	add("code", false, 4, nextCode);
+	add("nops", true, 2, [] { return uint16_t(0x0009); });
+	add("random", true, 3, nextWord);
+	add("code", false, 4, nextCode);
+	add("zero fill", true, 1, [] { return uint16_t(0); });
+	add("code", false, 4, nextCode);
+	add("random", true, 1, nextWord);
+
+	// too short to judge, so taken as code whatever it holds
+	for (size_t i = 0; i < classifyWindowWords / 8 - 1; i++)
+		words.push_back(nextWord());
+
+	expected.push_back(false);
+	kinds.push_back("short random tail");
+
+	const ImageView view{ words, 0, 0x8C010000 };
+	const auto windows = classifyWindows(view);
+	const auto kernel = selectWindowCountKernel();
+	std::vector<uint16_t> opIds(words.size());
+	size_t mismatches{};
+
+	Decoder::decodeBatch(words.data(), words.size(), opIds.data());
+
+	for (size_t w = 0; w < expected.size(); w++)
+	{
+		const auto first = w * classifyWindowWords;
+		const auto count = std::min(classifyWindowWords, words.size() - first);
+		const auto scalar = countWindowScalar(words.data() + first, opIds.data() + first, count);
+		const auto selected = kernel(words.data() + first, opIds.data() + first, count);
+
+		if (windows.size() != expected.size() || windows[w] != expected[w])
+		{
+			fprintf(stderr, "classify: window %zu (%s) came out as %s\n", w, kinds[w], windows.size() == expected.size() && windows[w] ? "data" : "code");
+			mismatches++;
+		}
+
+		if (scalar.invalid != selected.invalid || scalar.longestRun != selected.longestRun)
+		{
+			fprintf(stderr, "classify: window %zu (%s) counts differ from the scalar kernel\n", w, kinds[w]);
+			mismatches++;
+		}
+	}
+
+	if (mismatches)
+		return false;
+
+	printf("classify: all %zu windows came out as expected\n", expected.size());
+	return true;
+}
+
+// made up signatures, a nibble of the anchor left open and a wildcard in front
+// of every fourth so not every anchor is the first word
+static SignatureSet buildSignatureSet(size_t count, uint32_t& seed)
+{
+	SignatureSet set;
+
+	for (size_t k = 0; k < count; k++)
+	{
+		Signature signature;
+		signature.name = "sig" + std::to_string(k);
+
+		if (k % 4 == 3)
+		{
+			signature.values.push_back(0);
+			signature.masks.push_back(0);
+			signature.anchor = 1;
+		}
+
+		signature.values.push_back(uint16_t(nextRandom(seed) & 0xFF0F));
+		signature.masks.push_back(0xFF0F);
+
+		for (int i = 0; i < 3; i++)
+		{
+			signature.values.push_back(uint16_t(nextRandom(seed)));
+			signature.masks.push_back(0xFFFF);
+		}
+
+		set.signatures.push_back(std::move(signature));
+	}
+
+	set.buildCandidates();
+	return set;
+}
+
+// the vector anchor scan has to agree with the scalar one whichever path it
+// takes, and a search has to find every signature planted in random words
+static bool checkSignatures()
+{
+	const auto kernel = selectAnchorKernel();
+	size_t mismatches{};
+
+	for (size_t count : { 1, 4, 5, 400 })
+	{
+		uint32_t seed = 0x3C6EF372;
+		const auto set = buildSignatureSet(count, seed);
+
+		// an odd length so the scalar tail runs too
+		std::vector<uint16_t> words(64 * 1024 + 7);
+
+		for (auto& word : words)
+			word = uint16_t(nextRandom(seed));
+
+		std::vector<size_t> planted;
+
+		for (size_t k = 0; k < count; k++)
+		{
+			const auto& signature = set.signatures[k];
+			const size_t start = nextRandom(seed) % (words.size() - signature.values.size());
+
+			for (size_t i = 0; i < signature.values.size(); i++)
+				words[start + i] = uint16_t(signature.values[i] | (nextRandom(seed) & ~signature.masks[i]));
+
+			planted.push_back(start);
+		}
+
+		std::vector<uint32_t> scalar((words.size() + 15) / 16);
+		std::vector<uint32_t> selected(scalar.size());
+		findAnchorsScalar(set.anchors, set.anchorWords.data(), words.data(), words.size(), scalar.data());
+		kernel(set.anchors, set.anchorWords.data(), words.data(), words.size(), selected.data());
+
+		if (scalar != selected)
+		{
+			fprintf(stderr, "signatures: the anchor scan for %zu signatures differs from the scalar kernel\n", count);
+			mismatches++;
+		}
+
+		std::vector<bool> found(count);
+
+		set.search(words, [&](const Signature& signature, size_t start)
+		{
+			const size_t k = &signature - set.signatures.data();
+
+			if (planted[k] == start)
+				found[k] = true;
+		});
+
+		// a later plant can overwrite an earlier one, those can't be found
+		for (size_t k = 0; k < count; k++)
+		{
+			if (!found[k] && set.matches(set.signatures[k], words, planted[k]))
+			{
+				fprintf(stderr, "signatures: '%s' of %zu wasn't found\n", set.signatures[k].name.c_str(), count);
+				mismatches++;
+			}
+		}
+	}
+
+	if (mismatches)
+		return false;
+
+	printf("signatures: the anchor scans agree and every planted signature was found\n");
+	return true;
+}
+
+// the anchor scan for a couple of signatures and for hundreds of them (the
+// compare and the gather paths) over 8M random words
+static void benchSignatures(std::span<const uint16_t> words)
+{
+	const auto kernel = selectAnchorKernel();
+	std::vector<uint32_t> hits((words.size() + 15) / 16);
+
+	for (size_t count : { 4, 400 })
+	{
+		uint32_t seed = 0x6A09E667;
+		const auto set = buildSignatureSet(count, seed);
+		char dataset[32];
+		snprintf(dataset, sizeof(dataset), "%zu sigs", count);
+
+		auto scan = [&](AnchorKernel scanKernel)
+		{
+			return runPhase(words.size(), [&]
+			{
+				scanKernel(set.anchors, set.anchorWords.data(), words.data(), words.size(), hits.data());
+				return 0;
+			});
+		};
+
+		printPhase(dataset, "anchors scalar", scan(findAnchorsScalar));
+		printPhase(dataset, "anchors", scan(kernel));
+
+		const auto search = runPhase(words.size(), [&]
+		{
+			size_t found = 0;
+			set.search(words, [&](const Signature&, size_t) { found++; });
+			return 0;
+		});
+
+		printPhase(dataset, "find-sig", search);
+	}
+}
+
+static void printUsage()
+{
+	fprintf(stderr,
+		"usage: decompsh_bench [options] [image]\n"
+		"  --golden path        compare the listing of all 65536 opcodes against 'path'\n"
+		"  --write-golden path  write the listing of all 65536 opcodes to 'path'\n"
+		"  --check-binary       write every opcode as a --binary listing and read it back\n"
+		"  --check-cache        trace patched images through --cache and without it\n"
+		"  --check-classify     run the --skip-data classifier over a made up image\n"
+		"  --check-signatures   search random words for planted --find-sig signatures\n"
+		"  --no-bench           only run the checks\n"
+		"  image                a real image to time as well (default the BIOS next to the source)\n");
+}
+
+int main(int argc, const char** argv)
+{
+	std::string imagePath = std::string(PROJECT_PATH) + "/DC - BIOS.bin";
+	std::string goldenPath;
+	std::string writeGoldenPath;
+	bool checkBinary = false;
+	bool checkCache = false;
+	bool checkClassify = false;
+	bool checkSigs = false;
+	bool bench = true;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (!strcmp(arg, "--golden") && hasValue)
+			goldenPath = argv[++i];
+		else if (!strcmp(arg, "--write-golden") && hasValue)
+			writeGoldenPath = argv[++i];
+		else if (!strcmp(arg, "--check-binary"))
+			checkBinary = true;
+		else if (!strcmp(arg, "--check-cache"))
+			checkCache = true;
+		else if (!strcmp(arg, "--check-classify"))
+			checkClassify = true;
+		else if (!strcmp(arg, "--check-signatures"))
+			checkSigs = true;
+		else if (!strcmp(arg, "--no-bench"))
+			bench = false;
+		else if (!strcmp(arg, "-h") || !strcmp(arg, "--help"))
+		{
+			printUsage();
+			return 0;
+		}
+		else if (arg[0] == '-')
+		{
+			fprintf(stderr, "unknown option '%s'\n", arg);
+			printUsage();
+			return 1;
+		}
+		else
+			imagePath = arg;
+	}
+
+	std::vector<uint16_t> allOpcodes(0x10000);
+	for (size_t i = 0; i < allOpcodes.size(); i++)
+		allOpcodes[i] = uint16_t(i);
+
+	const ImageView allView{ allOpcodes, 0, 0 };
+
+	if (!writeGoldenPath.empty() || !goldenPath.empty())
+	{
+		const auto listing = listAllOpcodes(allView);
+
+		if (!writeGoldenPath.empty() && !writeGolden(writeGoldenPath, listing))
+			return 1;
+
+		if (!goldenPath.empty() && !checkGolden(goldenPath, listing))
+			return 1;
+	}
+
+	if (checkBinary && !checkBinaryListing({ allOpcodes, 0, 0x8C000000 }))
+		return 1;
+
+	if (checkCache && !checkAnalysisCache())
+		return 1;
+
+	if (checkClassify && !checkClassifier())
+		return 1;
+
+	if (checkSigs && !checkSignatures())
+		return 1;
+
+	if (!bench)
+		return 0;
+
+	// fixed seed so runs are comparable
+	std::vector<uint16_t> randomWords(8 * 1024 * 1024);
+	uint32_t seed = 0x2545F491;
+
+	for (auto& word : randomWords)
+		word = uint16_t(nextRandom(seed));
+
+	benchDataset({ "opcodes", allView });
+	benchDataset({ "random", { randomWords, 0, 0 } });
+
+	benchSignatures(randomWords);
+	benchInterpreter();
+
+	const MappedFile image(imagePath);
+
+	if (image.isValid())
+		benchDataset({ "image", { image.getWords(), image.offset, 0 } });
+	else
+		fprintf(stderr, "skipping image, couldn't open '%s'\n", imagePath.c_str());
+
+	return 0;
+}
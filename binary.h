@@ -0,0 +1,234 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <span>
+#include <algorithm>
+
+#include "image.h"
+#include "decoder.h"
+#include "classify.h"
+
+// the listing as fixed size records instead of text, for tools that want the
+// addresses, words and operands without parsing anything. everything is little
+// endian and laid out so the file can be mapped and used in place:
+//
+//   BinaryListingHeader
+//   BinaryInstruction[instructionCount]	the inst.inl table
+//   char[stringsSize]						its decode strings, each null terminated
+//   BinaryRecord[recordCount]				sorted by address
+//   uint32_t[pageCount]					first record at or after each page
+//
+// a record's operand fields are in printf order for its decode string, so
+// snprintf(decodeString, field0, field1, field2, field3) gives the text
+
+struct BinaryListingHeader
+{
+	char magic[4]{ 'D', 'S', 'H', 'L' };
+	uint32_t formatVersion{ 1 };
+	uint64_t decoderVersion{};
+	uint32_t instructionCount{};
+	uint32_t stringsSize{};
+	uint64_t recordCount{};
+	uint32_t firstAddress{};	// the first page starts here
+	uint32_t pageBits{};		// each page covers 1 << pageBits bytes of addresses
+	uint64_t pageCount{};
+	uint64_t instructionsOffset{};
+	uint64_t stringsOffset{};
+	uint64_t recordsOffset{};
+	uint64_t pagesOffset{};
+};
+
+struct BinaryInstruction
+{
+	uint32_t decodeString{};	// offset into the strings
+	uint16_t op{};
+	uint16_t decodingMask{};
+	uint8_t group{};			// Decoder::Group
+	uint8_t issueCycles{};
+	uint8_t latencyCycles{};
+	uint8_t valid{};
+};
+
+struct BinaryRecord
+{
+	enum : uint16_t
+	{
+		Data = 1 << 0,		// a literal pool or a window --skip-data took for data
+		Function = 1 << 1,	// an entry point or call target found by --recursive
+	};
+
+	uint32_t address{};
+	uint16_t word{};
+	uint16_t flags{};
+	DecodedInst inst{};
+};
+
+static_assert(sizeof(BinaryListingHeader) == 80 && sizeof(BinaryInstruction) == 12 && sizeof(BinaryRecord) == 12);
+
+inline constexpr uint32_t binaryPageBits = 12;
+
+// records go in as they are listed and are sorted and indexed when written
+struct BinaryListingWriter
+{
+	std::vector<BinaryRecord> records;
+
+	void add(const ImageView& view, const CodeDataMap& codeData, uint64_t position, size_t count, uint16_t flags = 0)
+	{
+		const auto first = size_t(position - view.offset) / 2;
+
+		for (size_t i = first; i < first + count; i++)
+		{
+			const auto word = view.words[i];
+			const bool data = codeData.isData(i) || codeData.isDataWindow(i / classifyWindowWords);
+
+			records.push_back({ uint32_t(view.getAddress(view.offset + i * 2)), word, uint16_t((data ? BinaryRecord::Data : 0) | (i == first ? flags : 0)), Decoder::decodedTable[word] });
+		}
+	}
+
+	bool write(FILE* file)
+	{
+		std::stable_sort(records.begin(), records.end(), [](const BinaryRecord& a, const BinaryRecord& b) { return a.address < b.address; });
+
+		BinaryListingHeader header;
+		header.decoderVersion = decoderVersion;
+		header.instructionCount = uint32_t(Decoder::instructionCount);
+		header.recordCount = records.size();
+		header.pageBits = binaryPageBits;
+
+		std::vector<BinaryInstruction> instructions;
+		std::string strings;
+
+		for (size_t i = 0; i < Decoder::instructionCount; i++)
+		{
+			const auto& inst = Decoder::instructions[i];
+
+			instructions.push_back({ uint32_t(strings.size()), inst.op, inst.decodingMask, uint8_t(inst.group), inst.issueCycles, inst.latencyCycles, inst.valid });
+			strings.append(inst.decodeString);
+			strings.push_back('\0');
+		}
+
+		// keeps the records aligned
+		strings.resize((strings.size() + 3) & ~size_t(3));
+		header.stringsSize = uint32_t(strings.size());
+
+		std::vector<uint32_t> pages;
+
+		if (!records.empty())
+		{
+			header.firstAddress = records.front().address & ~((1u << binaryPageBits) - 1);
+
+			const uint64_t lastPage = (records.back().address - header.firstAddress) >> binaryPageBits;
+			pages.resize(size_t(lastPage + 1));
+
+			size_t record = 0;
+
+			for (size_t page = 0; page < pages.size(); page++)
+			{
+				const uint64_t start = header.firstAddress + (uint64_t(page) << binaryPageBits);
+
+				while (record < records.size() && records[record].address < start)
+					record++;
+
+				pages[page] = uint32_t(record);
+			}
+		}
+
+		header.pageCount = pages.size();
+		header.instructionsOffset = sizeof(header);
+		header.stringsOffset = header.instructionsOffset + instructions.size() * sizeof(BinaryInstruction);
+		header.recordsOffset = header.stringsOffset + strings.size();
+		header.pagesOffset = header.recordsOffset + records.size() * sizeof(BinaryRecord);
+
+		return
+			fwrite(&header, sizeof(header), 1, file) == 1 &&
+			fwrite(instructions.data(), sizeof(BinaryInstruction), instructions.size(), file) == instructions.size() &&
+			fwrite(strings.data(), 1, strings.size(), file) == strings.size() &&
+			fwrite(records.data(), sizeof(BinaryRecord), records.size(), file) == records.size() &&
+			fwrite(pages.data(), sizeof(uint32_t), pages.size(), file) == pages.size();
+	}
+};
+
+// reads a binary listing in place. find() goes straight to the page holding
+// an address and only searches within it, pages of code are dense so it is
+// usually the first record looked at
+struct BinaryListing
+{
+	const BinaryListingHeader* header{};
+	std::span<const BinaryInstruction> instructions;
+	const char* strings{};
+	std::span<const BinaryRecord> records;
+	std::span<const uint32_t> pages;
+
+	// the sections and the page index are checked here and record ids in
+	// getDecodeString(), so a truncated or corrupt file is turned away instead
+	// of read past the end. the records themselves are left untouched
+	bool open(const uint8_t* data, uint64_t size)
+	{
+		const BinaryListingHeader expected{};
+		header = reinterpret_cast<const BinaryListingHeader*>(data);
+
+		if (size < sizeof(BinaryListingHeader) || memcmp(header->magic, expected.magic, sizeof(expected.magic)) || header->formatVersion != expected.formatVersion)
+			return false;
+
+		// written this way so huge counts can't overflow into something that fits
+		auto fits = [size](uint64_t offset, uint64_t count, uint64_t elementSize)
+		{
+			return offset % 4 == 0 && offset <= size && count <= (size - offset) / elementSize;
+		};
+
+		if (!fits(header->instructionsOffset, header->instructionCount, sizeof(BinaryInstruction)) ||
+			!fits(header->stringsOffset, header->stringsSize, 1) ||
+			!fits(header->recordsOffset, header->recordCount, sizeof(BinaryRecord)) ||
+			!fits(header->pagesOffset, header->pageCount, sizeof(uint32_t)) ||
+			header->pageBits >= 32 || (header->stringsSize && data[header->stringsOffset + header->stringsSize - 1]))
+			return false;
+
+		instructions = { reinterpret_cast<const BinaryInstruction*>(data + header->instructionsOffset), header->instructionCount };
+		strings = reinterpret_cast<const char*>(data + header->stringsOffset);
+		records = { reinterpret_cast<const BinaryRecord*>(data + header->recordsOffset), size_t(header->recordCount) };
+		pages = { reinterpret_cast<const uint32_t*>(data + header->pagesOffset), size_t(header->pageCount) };
+
+		for (const auto& instruction : instructions)
+			if (instruction.decodeString >= header->stringsSize)
+				return false;
+
+		for (size_t page = 0; page < pages.size(); page++)
+			if (pages[page] > records.size() || (page && pages[page] < pages[page - 1]))
+				return false;
+
+		return true;
+	}
+
+	const BinaryRecord* find(uint32_t address) const
+	{
+		const uint64_t page = uint64_t(address - header->firstAddress) >> header->pageBits;
+
+		if (address < header->firstAddress || page >= pages.size())
+			return nullptr;
+
+		const auto begin = records.begin() + pages[page];
+		const auto end = page + 1 < pages.size() ? records.begin() + pages[page + 1] : records.end();
+
+		if (begin == end || address < begin->address)
+			return nullptr;
+
+		// where it would be if the page has no gaps
+		const auto guess = begin + std::min<ptrdiff_t>((address - begin->address) / 2, end - begin - 1);
+
+		if (guess->address == address)
+			return &*guess;
+
+		const auto it = std::lower_bound(begin, end, address, [](const BinaryRecord& r, uint32_t a) { return r.address < a; });
+		return it != end && it->address == address ? &*it : nullptr;
+	}
+
+	// nullptr if the record's id isn't in the table
+	const char* getDecodeString(const BinaryRecord& record) const
+	{
+		return record.inst.id < instructions.size() ? strings + instructions[record.inst.id].decodeString : nullptr;
+	}
+};
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <array>
+#include <vector>
+#include <span>
+#include <iterator>
+#include <algorithm>
+#include <bit>
+
+#include "image.h"
+#include "decoder.h"
+
+// guesses which parts of an image are data (compressed graphics, fonts, tables,
+// padding) before a linear sweep, from a few statistics per window of words.
+// none of them need the text, the words are only run through decodeBatch
+
+inline constexpr size_t classifyWindowWords = 256;
+
+struct WindowStats
+{
+	double invalid{};	// words that aren't an instruction
+	double entropy{};	// bits per byte
+	double fill{};		// the longest run of one repeated word
+	double topClass{};	// the most common top nibble, which is the opcode class on SH4
+};
+
+// count * log2(count) for every count a window's byte histogram can hold
+inline const std::array<double, classifyWindowWords * 2 + 1>& getEntropyTerms()
+{
+	static const auto terms = []
+	{
+		std::array<double, classifyWindowWords * 2 + 1> table{};
+
+		for (size_t i = 1; i < table.size(); i++)
+			table[i] = double(i) * std::log2(double(i));
+
+		return table;
+	}();
+
+	return terms;
+}
+
+// every word that doesn't decode gets the unknown entry at the end of the
+// instruction table, so counting invalid words is counting that one id
+inline constexpr auto unknownOpId = uint16_t(Decoder::instructionCount - 1);
+
+static_assert([]
+{
+	for (size_t i = 0; i < unknownOpId; i++)
+		if (!Decoder::instructions[i].valid)
+			return false;
+
+	return !Decoder::instructions[unknownOpId].valid;
+}());
+
+struct WindowCounts
+{
+	size_t invalid{};
+	size_t longestRun{};	// of one repeated word
+};
+
+using WindowCountKernel = WindowCounts (*)(const uint16_t* words, const uint16_t* opIds, size_t n);
+
+static WindowCounts countWindowScalar(const uint16_t* words, const uint16_t* opIds, size_t n)
+{
+	WindowCounts counts;
+	size_t run{};
+
+	for (size_t i = 0; i < n; i++)
+	{
+		counts.invalid += opIds[i] == unknownOpId;
+
+		run = i && words[i] == words[i - 1] ? run + 1 : 1;
+		counts.longestRun = std::max(counts.longestRun, run);
+	}
+
+	return counts;
+}
+
+#if DECOMPSH_X86
+// 16 words at a time, compared against the unknown id for the invalid count
+// and against the words one before them for the runs. movemask gives two bits
+// per word, so every count in here is halved
+DECOMPSH_TARGET("avx2") static WindowCounts countWindowAvx2(const uint16_t* words, const uint16_t* opIds, size_t n)
+{
+	if (!n)
+		return {};
+
+	const __m256i unknown = _mm256_set1_epi16(short(unknownOpId));
+	WindowCounts counts{ opIds[0] == unknownOpId, 1 };
+	size_t run = 1;		// the word before the next group and the ones repeating it
+	size_t i = 1;
+
+	for (; i + 16 <= n; i += 16)
+	{
+		const __m256i ids = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(opIds + i));
+		const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+		const __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i - 1));
+
+		counts.invalid += size_t(std::popcount(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi16(ids, unknown))))) / 2;
+
+		const auto repeats = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi16(current, previous)));
+
+		if (repeats == UINT32_MAX)
+		{
+			run += 16;
+			continue;
+		}
+
+		// the group starts by carrying on the run before it...
+		counts.longestRun = std::max(counts.longestRun, run + size_t(std::countr_one(repeats)) / 2);
+
+		// ...may have longer ones inside...
+		size_t inside{};
+
+		for (auto bits = repeats & 0x55555555; bits; bits &= bits >> 2)
+			inside++;
+
+		counts.longestRun = std::max(counts.longestRun, inside + 1);
+
+		// ...and ends with the start of the next
+		run = 1 + size_t(std::countl_one(repeats)) / 2;
+	}
+
+	counts.longestRun = std::max(counts.longestRun, run);
+
+	for (; i < n; i++)
+	{
+		counts.invalid += opIds[i] == unknownOpId;
+
+		run = words[i] == words[i - 1] ? run + 1 : 1;
+		counts.longestRun = std::max(counts.longestRun, run);
+	}
+
+	return counts;
+}
+#endif
+
+inline WindowCountKernel selectWindowCountKernel()
+{
+#if DECOMPSH_X86
+	if (getCpuFeatures().avx2)
+		return countWindowAvx2;
+#endif
+
+	return countWindowScalar;
+}
+
+inline WindowStats measureWindow(std::span<const uint16_t> words, const uint16_t* opIds)
+{
+	static const auto kernel = selectWindowCountKernel();
+
+	const auto& terms = getEntropyTerms();
+	uint16_t bytes[256]{};
+	uint16_t classes[16]{};
+
+	for (const auto word : words)
+	{
+		bytes[word & 0xFF]++;
+		bytes[word >> 8]++;
+		classes[word >> 12]++;
+	}
+
+	const auto counts = kernel(words.data(), opIds, words.size());
+
+	// H = log2(n) - sum(c * log2(c)) / n
+	const size_t byteCount = words.size() * 2;
+	double sum{};
+
+	for (const auto count : bytes)
+		sum += terms[count];
+
+	const double n = double(words.size());
+	const auto topClass = *std::max_element(std::begin(classes), std::end(classes));
+
+	return { counts.invalid / n, std::log2(double(byteCount)) - sum / double(byteCount), counts.longestRun / n, topClass / n };
+}
+
+// compiled code sits around 6 to 7 bits of entropy per byte with a spread of
+// opcode classes, and literal pools keep some of it from decoding. random or
+// compressed bytes decode 90% of the time, so entropy is what catches those,
+// while tables, fonts and fill are too regular to be code
+inline bool looksLikeData(const WindowStats& stats)
+{
+	return stats.invalid > 0.2 || stats.entropy > 7.2 || stats.entropy < 4.0 || stats.fill > 0.5 || stats.topClass > 0.5;
+}
+
+// one entry per classifyWindowWords words of 'view', true where it looks like
+// data. a last window of fewer than classifyWindowWords / 8 words is too short
+// to judge and is taken as code, a longer one is measured like the others
+inline std::vector<bool> classifyWindows(const ImageView& view)
+{
+	const auto& words = view.words;
+	std::vector<bool> windows((words.size() + classifyWindowWords - 1) / classifyWindowWords);
+	uint16_t opIds[classifyWindowWords];
+
+	for (size_t w = 0; w < windows.size(); w++)
+	{
+		const auto window = words.subspan(w * classifyWindowWords, std::min(classifyWindowWords, words.size() - w * classifyWindowWords));
+
+		if (window.size() < classifyWindowWords / 8)
+			continue;
+
+		Decoder::decodeBatch(window.data(), window.size(), opIds);
+		windows[w] = looksLikeData(measureWindow(window, opIds));
+	}
+
+	return windows;
+}
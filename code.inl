@@ -0,0 +1,2657 @@
+// mov Rm,Rn
+template <> inline void Interpreter::execute<0>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = R[m];
+	PC += 2;
+}
+
+// mov #imm,Rn
+template <> inline void Interpreter::execute<1>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int i = code & 0xFF;
+
+	if ((i & 0x80) == 0)
+		R[n] = (0x000000FF & i);
+	else
+		R[n] = (0xFFFFFF00 | i);
+
+	PC += 2;
+}
+
+// mova @(disp,PC),R0
+template <> inline void Interpreter::execute<2>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	uint32_t disp;
+	disp = (uint32_t)(0x000000FF & d);
+	R[0] = (PC & 0xFFFFFFFC) + 4 + (disp << 2);
+	PC += 2;
+}
+
+// mov.w @(disp,PC),Rn
+template <> inline void Interpreter::execute<3>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & d);
+	R[n] = Read_16 (PC + 4 + (disp << 1));
+	if ((R[n] & 0x8000) == 0)
+		R[n] &= 0x0000FFFF;
+	else
+		R[n] |= 0xFFFF0000;
+
+	PC += 2;
+}
+
+// mov.l @(disp,PC),Rn
+template <> inline void Interpreter::execute<4>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & d);
+	R[n] = Read_32 ((PC & 0xFFFFFFFC) + 4 + (disp << 2));
+	PC += 2;
+}
+
+// mov.b @Rm,Rn
+template <> inline void Interpreter::execute<5>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_8 (R[m]);
+	if ((R[n] & 0x80) == 0)
+		R[n] &= 0x000000FF;
+	else
+		R[n] |= 0xFFFFFF00;
+
+	PC += 2;
+}
+
+// mov.w @Rm,Rn
+template <> inline void Interpreter::execute<6>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_16 (R[m]);
+	if ((R[n] & 0x8000) == 0)
+		R[n] &= 0x0000FFFF;
+	else
+		R[n] |= 0xFFFF0000;
+
+	PC += 2;
+}
+
+// mov.l @Rm,Rn
+template <> inline void Interpreter::execute<7>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_32 (R[m]);
+	PC += 2;
+}
+
+// mov.b Rm,@Rn
+template <> inline void Interpreter::execute<8>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_8 (R[n], R[m]);
+	PC += 2;
+}
+
+// mov.w Rm,@Rn
+template <> inline void Interpreter::execute<9>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_16 (R[n], R[m]);
+	PC += 2;
+}
+
+// mov.l Rm,@Rn
+template <> inline void Interpreter::execute<10>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_32 (R[n], R[m]);
+	PC += 2;
+}
+
+// mov.b @Rm+,Rn
+template <> inline void Interpreter::execute<11>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_8 (R[m]);
+	if ((R[n] & 0x80) == 0)
+		R[n] &= 0x000000FF;
+	else
+		R[n] |= 0xFFFFFF00;
+
+	if (n != m)
+		R[m] += 1;
+
+	PC += 2;
+}
+
+// mov.w @Rm+,Rn
+template <> inline void Interpreter::execute<12>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_16 (R[m]);
+	if ((R[n] & 0x8000) == 0)
+		R[n] &= 0x0000FFFF;
+	else
+		R[n] |= 0xFFFF0000;
+
+	if (n != m)
+		R[m] += 2;
+
+	PC += 2;
+}
+
+// mov.l @Rm+,Rn
+template <> inline void Interpreter::execute<13>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_32 (R[m]);
+
+	if (n != m)
+		R[m] += 4;
+
+	PC += 2;
+}
+
+// mov.b Rm,@-Rn
+template <> inline void Interpreter::execute<14>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_8 (R[n] - 1, R[m]);
+	R[n] -= 1;
+	PC += 2;
+}
+
+// mov.w Rm,@-Rn
+template <> inline void Interpreter::execute<15>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_16 (R[n] - 2, R[m]);
+	R[n] -= 2;
+	PC += 2;
+}
+
+// mov.l Rm,@-Rn
+template <> inline void Interpreter::execute<16>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_32 (R[n] - 4, R[m]);
+	R[n] -= 4;
+	PC += 2;
+}
+
+// mov.b @(disp,Rm),R0
+template <> inline void Interpreter::execute<17>(uint16_t code)
+{
+	const int m = (code >> 4) & 0xF;
+	const int d = code & 0xF;
+
+	int32_t disp = (0x0000000F & (int32_t)d);
+	R[0] = Read_8 (R[m] + disp);
+
+	if ((R[0] & 0x80) == 0)
+		R[0] &= 0x000000FF;
+	else
+		R[0] |= 0xFFFFFF00;
+
+	PC += 2;
+}
+
+// mov.w @(disp,Rm),R0
+template <> inline void Interpreter::execute<18>(uint16_t code)
+{
+	const int m = (code >> 4) & 0xF;
+	const int d = code & 0xF;
+
+	int32_t disp = (0x0000000F & (int32_t)d);
+	R[0] = Read_16 (R[m] + (disp << 1));
+
+	if ((R[0] & 0x8000) == 0)
+		R[0] &= 0x0000FFFF;
+	else
+		R[0] |= 0xFFFF0000;
+
+	PC += 2;
+}
+
+// mov.l @(disp,Rm),Rn
+template <> inline void Interpreter::execute<19>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+	const int d = code & 0xF;
+
+	int32_t disp = (0x0000000F & (int32_t)d);
+	R[n] = Read_32 (R[m] + (disp << 2));
+	PC += 2;
+}
+
+// mov.b R0,@(disp,Rn)
+template <> inline void Interpreter::execute<20>(uint16_t code)
+{
+	const int n = (code >> 4) & 0xF;
+	const int d = code & 0xF;
+
+	int32_t disp = (0x0000000F & (int32_t)d);
+	Write_8 (R[n] + disp, R[0]);
+	PC += 2;
+}
+
+// mov.w R0,@(disp,Rn)
+template <> inline void Interpreter::execute<21>(uint16_t code)
+{
+	const int n = (code >> 4) & 0xF;
+	const int d = code & 0xF;
+
+	int32_t disp = (0x0000000F & (int32_t)d);
+	Write_16 (R[n] + (disp << 1), R[0]);
+	PC += 2;
+}
+
+// mov.l Rm,@(disp,Rn)
+template <> inline void Interpreter::execute<22>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+	const int d = code & 0xF;
+
+	int32_t disp = (0x0000000F & (int32_t)d);
+	Write_32 (R[n] + (disp << 2), R[m]);
+	PC += 2;
+}
+
+// mov.b @(R0,Rm),Rn
+template <> inline void Interpreter::execute<23>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_8 (R[m] + R[0]);
+
+	if ((R[n] & 0x80) == 0)
+		R[n] &= 0x000000FF;
+	else R[n] |= 0xFFFFFF00;
+
+	PC += 2;
+}
+
+// mov.w @(R0,Rm),Rn
+template <> inline void Interpreter::execute<24>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_16 (R[m] + R[0]);
+
+	if ((R[n] & 0x8000) == 0)
+		R[n] &= 0x0000FFFF;
+	else
+		R[n] |= 0xFFFF0000;
+
+	PC += 2;
+}
+
+// mov.l @(R0,Rm),Rn
+template <> inline void Interpreter::execute<25>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = Read_32 (R[m] + R[0]);
+	PC += 2;
+}
+
+// mov.b Rm,@(R0,Rn)
+template <> inline void Interpreter::execute<26>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_8 (R[n] + R[0], R[m]);
+	PC += 2;
+}
+
+// mov.w Rm,@(R0,Rn)
+template <> inline void Interpreter::execute<27>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_16 (R[n] + R[0], R[m]);
+	PC += 2;
+}
+
+// mov.l Rm,@(R0,Rn)
+template <> inline void Interpreter::execute<28>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_32 (R[n] + R[0], R[m]);
+	PC += 2;
+}
+
+// mov.b @(disp,GBR),R0
+template <> inline void Interpreter::execute<29>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & d);
+	R[0] = Read_8 (GBR + disp);
+
+	if ((R[0] & 0x80) == 0)
+		R[0] &= 0x000000FF;
+	else
+		R[0] |= 0xFFFFFF00;
+
+	PC += 2;
+}
+
+// mov.w @(disp,GBR),R0
+template <> inline void Interpreter::execute<30>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & d);
+	R[0] = Read_16 (GBR + (disp << 1));
+
+	if ((R[0] & 0x8000) == 0)
+		R[0] &= 0x0000FFFF;
+	else
+		R[0] |= 0xFFFF0000;
+
+	PC += 2;
+}
+
+// mov.l @(disp,GBR),R0
+template <> inline void Interpreter::execute<31>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & d);
+	R[0] = Read_32 (GBR + (disp << 2));
+	PC += 2;
+}
+
+// mov.b R0,@(disp,GBR)
+template <> inline void Interpreter::execute<32>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & d);
+	Write_8 (GBR + disp, R[0]);
+	PC += 2;
+}
+
+// mov.w R0,@(disp,GBR)
+template <> inline void Interpreter::execute<33>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & d);
+	Write_16 (GBR + (disp << 1), R[0]);
+	PC += 2;
+}
+
+// mov.l R0,@(disp,GBR)
+template <> inline void Interpreter::execute<34>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	uint32_t disp = (0x000000FF & (int32_t)d);
+	Write_32 (GBR + (disp << 2), R[0]);
+	PC += 2;
+}
+
+// movt Rn
+template <> inline void Interpreter::execute<39>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if (SR.T == 1)
+		R[n] = 0x00000001;
+	else
+		R[n] = 0x00000000;
+	PC += 2;
+}
+
+// swap.b Rm,Rn
+template <> inline void Interpreter::execute<40>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t temp0, temp1;
+	temp0 = R[m] & 0xFFFF0000;
+	temp1 = (R[m] & 0x000000FF) << 8;
+	R[n] = (R[m] & 0x0000FF00) >> 8;
+	R[n] = R[n] | temp1 | temp0;
+	PC += 2;
+}
+
+// swap.w Rm,Rn
+template <> inline void Interpreter::execute<41>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t temp;
+	temp = (R[m] >> 16) & 0x0000FFFF;
+	R[n] = R[m] << 16;
+	R[n] |= temp;
+	PC += 2;
+}
+
+// xtrct Rm,Rn
+template <> inline void Interpreter::execute<42>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t high = (R[m] << 16) & 0xFFFF0000;
+	uint32_t low = (R[n] >> 16) & 0x0000FFFF;
+	R[n] = high | low;
+	PC += 2;
+}
+
+// add Rm,Rn
+template <> inline void Interpreter::execute<43>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] += R[m];
+	PC += 2;
+}
+
+// add #imm,Rn
+template <> inline void Interpreter::execute<44>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int i = code & 0xFF;
+
+	if ((i & 0x80) == 0)
+		R[n] += (0x000000FF & (int32_t)i);
+	else
+		R[n] += (0xFFFFFF00 | (int32_t)i);
+
+	PC += 2;
+}
+
+// addc Rm,Rn
+template <> inline void Interpreter::execute<45>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t tmp0, tmp1;
+	tmp1 = R[n] + R[m];
+	tmp0 = R[n];
+	R[n] = tmp1 + SR.T;
+
+	if (tmp0>tmp1)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	if (tmp1 > R[n])
+		SR.T = 1;
+
+	PC += 2;
+}
+
+// addv Rm,Rn
+template <> inline void Interpreter::execute<46>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	int32_t dest, src, ans;
+
+	if ((int32_t)R[n] >= 0)
+		dest = 0;
+	else
+		dest = 1;
+
+	if ((int32_t)R[m] >= 0)
+		src = 0;
+	else
+		src = 1;
+
+	src += dest;
+	R[n] += R[m];
+
+	if ((int32_t)R[n] >= 0)
+		ans = 0;
+	else
+		ans = 1;
+
+	ans += dest;
+
+	if (src == 0 || src == 2)
+	{
+		if (ans == 1)
+			SR.T = 1;
+		else
+			SR.T = 0;
+	}
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/eq #imm,R0
+template <> inline void Interpreter::execute<47>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	int32_t imm;
+
+	if ((i & 0x80) == 0)
+		imm = (0x000000FF & (int32_t)i);
+	else
+		imm = (0xFFFFFF00 | (int32_t)i);
+
+	if (R[0] == (uint32_t)imm)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/eq Rm,Rn
+template <> inline void Interpreter::execute<48>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	if (R[n] == R[m])
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/hs Rm,Rn
+template <> inline void Interpreter::execute<49>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	if ((uint32_t)R[n] >= (uint32_t)R[m])
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/ge Rm,Rn
+template <> inline void Interpreter::execute<50>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	if ((int32_t)R[n] >= (int32_t)R[m])
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/hi Rm,Rn
+template <> inline void Interpreter::execute<51>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	if ((uint32_t)R[n] > (uint32_t)R[m])
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/gt Rm,Rn
+template <> inline void Interpreter::execute<52>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	if ((int32_t)R[n] > (int32_t)R[m])
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/pl Rn
+template <> inline void Interpreter::execute<53>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if ((int32_t)R[n] > 0)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/pz Rn
+template <> inline void Interpreter::execute<54>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if ((int32_t)R[n] >= 0)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// cmp/str Rm,Rn
+template <> inline void Interpreter::execute<55>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t temp;
+	int32_t HH, HL, LH, LL;
+	temp = R[n] ^ R[m];
+	HH = (temp & 0xFF000000) >> 24;
+	HL = (temp & 0x00FF0000) >> 16;
+	LH = (temp & 0x0000FF00) >> 8;
+	LL = temp & 0x000000FF;
+	HH = HH && HL && LH && LL;
+
+	if (HH == 0)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// div0s Rm,Rn
+template <> inline void Interpreter::execute<56>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	if ((R[n] & 0x80000000) == 0)
+		SR.Q = 0;
+	else
+		SR.Q = 1;
+
+	if ((R[m] & 0x80000000) == 0)
+		SR.M = 0;
+	else
+		SR.M = 1;
+
+	SR.T = ! (SR.M == SR.Q);
+	PC += 2;
+}
+
+// div0u
+template <> inline void Interpreter::execute<57>(uint16_t)
+{
+	SR.M = SR.Q = SR.T = 0;
+	PC += 2;
+}
+
+// div1 Rm,Rn
+template <> inline void Interpreter::execute<58>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t tmp0, tmp2;
+	uint8_t old_q, tmp1;
+
+	old_q = SR.Q;
+	SR.Q = (0x80000000 & R[n]) != 0;
+	tmp2 = R[m];
+	R[n] <<= 1;
+	R[n] |= (uint32_t)SR.T;
+
+	if (old_q == 0)
+	{
+		if (SR.M == 0)
+		{
+			tmp0 = R[n];
+			R[n] -= tmp2;
+			tmp1 = R[n] > tmp0;
+
+			if (SR.Q == 0)
+				SR.Q = tmp1;
+			else if (SR.Q == 1)
+				SR.Q = tmp1 == 0;
+		}
+
+		else if (SR.M == 1)
+		{
+			tmp0 = R[n];
+			R[n] += tmp2;
+			tmp1 = R[n] < tmp0;
+
+			if (SR.Q == 0)
+				SR.Q = tmp1 == 0;
+			else if (SR.Q == 1)
+				SR.Q = tmp1;
+		}
+	}
+
+	else if (old_q == 1)
+	{
+		if (SR.M == 0)
+		{
+			tmp0 = R[n];
+			R[n] += tmp2;
+			tmp1 = R[n] < tmp0;
+
+			if (SR.Q == 0)
+				SR.Q = tmp1;
+			else if (SR.Q == 1)
+				SR.Q = tmp1 == 0;
+		}
+
+		else if (SR.M == 1)
+		{
+			 tmp0 = R[n];
+			 R[n] -= tmp2;
+			 tmp1 = R[n] > tmp0;
+
+			 if (SR.Q == 0)
+				 SR.Q = tmp1 == 0;
+			 else if (SR.Q == 1)
+				 SR.Q = tmp1;
+		}
+	}
+
+	SR.T = (SR.Q == SR.M);
+	PC += 2;
+}
+
+// dmuls.l Rm,Rn
+template <> inline void Interpreter::execute<59>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t RnL, RnH, RmL, RmH, Res0, Res1, Res2;
+	uint32_t temp0, temp1, temp2, temp3;
+	int32_t tempm, tempn, fnLmL;
+
+	tempn = (int32_t)R[n];
+	tempm = (int32_t)R[m];
+
+	if (tempn < 0)
+		tempn = 0 - tempn;
+
+	if (tempm < 0)
+		tempm = 0 - tempm;
+
+	if ((int32_t)(R[n] ^ R[m]) < 0)
+		fnLmL = -1;
+	else
+		fnLmL = 0;
+
+	temp1 = (uint32_t)tempn;
+	temp2 = (uint32_t)tempm;
+
+	RnL = temp1 & 0x0000FFFF;
+	RnH = (temp1 >> 16) & 0x0000FFFF;
+
+	RmL = temp2 & 0x0000FFFF;
+	RmH = (temp2 >> 16) & 0x0000FFFF;
+
+	temp0 = RmL * RnL;
+	temp1 = RmH * RnL;
+	temp2 = RmL * RnH;
+	temp3 = RmH * RnH;
+
+	Res2 = 0;
+	Res1 = temp1 + temp2;
+	if (Res1 < temp1)
+		Res2 += 0x00010000;
+
+	temp1 = (Res1 << 16) & 0xFFFF0000;
+	Res0 = temp0 + temp1;
+	if (Res0 < temp0)
+		Res2++;
+
+	Res2 = Res2 + ((Res1 >> 16) & 0x0000FFFF) + temp3;
+
+	if (fnLmL < 0)
+	{
+		Res2 = ~Res2;
+		if (Res0 == 0)
+			Res2++;
+		else
+			Res0 = (~Res0) + 1;
+	}
+
+	MACH = Res2;
+	MACL = Res0;
+	PC += 2;
+}
+
+// dmulu.l Rm,Rn
+template <> inline void Interpreter::execute<60>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t RnL, RnH, RmL, RmH, Res0, Res1, Res2;
+	uint32_t temp0, temp1, temp2, temp3;
+
+	RnL = R[n] & 0x0000FFFF;
+	RnH = (R[n] >> 16) & 0x0000FFFF;
+
+	RmL = R[m] & 0x0000FFFF;
+	RmH = (R[m] >> 16) & 0x0000FFFF;
+
+	temp0 = RmL * RnL;
+	temp1 = RmH * RnL;
+	temp2 = RmL * RnH;
+	temp3 = RmH * RnH;
+
+	Res2 = 0;
+	Res1 = temp1 + temp2;
+	if (Res1 < temp1)
+		Res2 += 0x00010000;
+
+	temp1 = (Res1 << 16) & 0xFFFF0000;
+	Res0 = temp0 + temp1;
+	if (Res0 < temp0)
+		Res2++;
+
+	Res2 = Res2 + ((Res1 >> 16) & 0x0000FFFF) + temp3;
+
+	MACH = Res2;
+	MACL = Res0;
+	PC += 2;
+}
+
+// dt Rn
+template <> inline void Interpreter::execute<61>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n]--;
+
+	if (R[n] == 0)
+		SR.T = 1;
+	else SR.T = 0;
+
+	PC += 2;
+}
+
+// exts.b Rm,Rn
+template <> inline void Interpreter::execute<62>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = R[m];
+
+	if ((R[m] & 0x00000080) == 0)
+		R[n] &= 0x000000FF;
+	else
+		R[n] |= 0xFFFFFF00;
+
+	PC += 2;
+}
+
+// exts.w Rm,Rn
+template <> inline void Interpreter::execute<63>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = R[m];
+
+	if ((R[m] & 0x00008000) == 0)
+		R[n] &= 0x0000FFFF;
+	else
+		R[n] |= 0xFFFF0000;
+
+	PC += 2;
+}
+
+// extu.b Rm,Rn
+template <> inline void Interpreter::execute<64>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = R[m];
+	R[n] &= 0x000000FF;
+	PC += 2;
+}
+
+// extu.w Rm,Rn
+template <> inline void Interpreter::execute<65>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = R[m];
+	R[n] &= 0x0000FFFF;
+	PC += 2;
+}
+
+// mac.l @Rm+,@Rn+
+template <> inline void Interpreter::execute<66>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t RnL, RnH, RmL, RmH, Res0, Res1, Res2;
+	uint32_t temp0, temp1, temp2, temp3;
+	int32_t tempm, tempn, fnLmL;
+
+	tempn = Read_32 (R[n]);
+	R[n] += 4;
+	tempm = Read_32 (R[m]);
+	R[m] += 4;
+
+	if ((int32_t)(tempn ^ tempm) < 0)
+		fnLmL = -1;
+	else
+		fnLmL = 0;
+
+	if (tempn < 0)
+		tempn = 0 - tempn;
+	if (tempm < 0)
+		tempm = 0 - tempm;
+
+	temp1 = (uint32_t)tempn;
+	temp2 = (uint32_t)tempm;
+
+	RnL = temp1 & 0x0000FFFF;
+	RnH = (temp1 >> 16) & 0x0000FFFF;
+	RmL = temp2 & 0x0000FFFF;
+	RmH = (temp2 >> 16) & 0x0000FFFF;
+	temp0 = RmL * RnL;
+	temp1 = RmH * RnL;
+	temp2 = RmL * RnH;
+	temp3 = RmH * RnH;
+
+	Res2 = 0;
+
+	Res1 = temp1 + temp2;
+	if (Res1 < temp1)
+		Res2 += 0x00010000;
+
+	temp1 = (Res1 << 16) & 0xFFFF0000;
+
+	Res0 = temp0 + temp1;
+	if (Res0 < temp0)
+		Res2++;
+
+	Res2 = Res2 + ((Res1 >> 16) & 0x0000FFFF) + temp3;
+
+	if(fnLmL < 0)
+	{
+		Res2 = ~Res2;
+		if (Res0 == 0)
+			Res2++;
+		else
+			Res0 = (~Res0) + 1;
+	}
+
+	if (SR.S == 1)
+	{
+		Res0 = MACL + Res0;
+		if (MACL > Res0)
+			Res2++;
+
+		Res2 += MACH & 0x0000FFFF;
+
+		if (((int32_t)Res2 < 0) && (Res2 < 0xFFFF8000))
+		{
+			Res2 = 0xFFFF8000;
+			Res0 = 0x00000000;
+		}
+
+		if (((int32_t)Res2 > 0) && (Res2 > 0x00007FFF))
+		{
+			Res2 = 0x00007FFF;
+			Res0 = 0xFFFFFFFF;
+		}
+
+		MACH = (Res2 & 0x0000FFFF) | (MACH & 0xFFFF0000);
+		MACL = Res0;
+	}
+	else
+	{
+		Res0 = MACL + Res0;
+		if (MACL > Res0)
+			Res2 ++;
+
+		Res2 += MACH;
+		MACH = Res2;
+		MACL = Res0;
+	}
+
+	PC += 2;
+}
+
+// mac.w @Rm+,@Rn+
+template <> inline void Interpreter::execute<67>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	int32_t tempm, tempn, dest, src, ans;
+	uint32_t templ;
+
+	tempn = Read_16 (R[n]);
+	R[n] += 2;
+	tempm = Read_16 (R[m]);
+	R[m] += 2;
+
+	templ = MACL;
+	tempm = ((int32_t)(int16_t)tempn * (int32_t)(int16_t)tempm);
+
+	if ((int32_t)MACL >= 0)
+		dest = 0;
+	else
+		dest = 1;
+
+	if ((int32_t)tempm >= 0)
+	{
+		src = 0;
+		tempn = 0;
+	}
+	else
+	{
+		src = 1;
+		tempn = 0xFFFFFFFF;
+	}
+
+	src += dest;
+	MACL += tempm;
+
+	if ((int32_t)MACL >= 0)
+		ans = 0;
+	else
+		ans = 1;
+
+	ans += dest;
+
+	if (SR.S == 1)
+	{
+		if (ans == 1)
+		{
+
+			if (src == 0)
+				MACL = 0x7FFFFFFF;
+			if (src == 2)
+				MACL = 0x80000000;
+		}
+	}
+	else
+	{
+		MACH += tempn;
+		if (templ > MACL)
+			MACH += 1;
+
+	}
+
+	PC += 2;
+}
+
+// mul.l Rm,Rn
+template <> inline void Interpreter::execute<68>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	MACL = R[n] * R[m];
+	PC += 2;
+}
+
+// muls.w Rm,Rn
+template <> inline void Interpreter::execute<69>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	MACL = ((int32_t)(int16_t)R[n] * (int32_t)(int16_t)R[m]);
+	PC += 2;
+}
+
+// mulu.w Rm,Rn
+template <> inline void Interpreter::execute<70>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	MACL = ((uint32_t)(uint16_t)R[n]* (uint32_t)(uint16_t)R[m]);
+	PC += 2;
+}
+
+// neg Rm,Rn
+template <> inline void Interpreter::execute<71>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = 0 - R[m];
+	PC += 2;
+}
+
+// negc Rm,Rn
+template <> inline void Interpreter::execute<72>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t temp;
+	temp = 0 - R[m];
+	R[n] = temp - SR.T;
+
+	if (0 < temp)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	if (temp < R[n])
+		SR.T = 1;
+
+	PC += 2;
+}
+
+// sub Rm,Rn
+template <> inline void Interpreter::execute<73>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] -= R[m];
+	PC += 2;
+}
+
+// subc Rm,Rn
+template <> inline void Interpreter::execute<74>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	uint32_t tmp0, tmp1;
+	tmp1 = R[n] - R[m];
+	tmp0 = R[n];
+	R[n] = tmp1 - SR.T;
+
+	if (tmp0 < tmp1)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	if (tmp1 < R[n])
+		SR.T = 1;
+
+	PC += 2;
+}
+
+// subv Rm,Rn
+template <> inline void Interpreter::execute<75>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	int32_t dest, src, ans;
+
+	if ((int32_t)R[n] >= 0)
+		dest = 0;
+	else
+		dest = 1;
+
+	if ((int32_t)R[m] >= 0)
+		src = 0;
+	else
+		src = 1;
+
+	src += dest;
+	R[n] -= R[m];
+
+	if ((int32_t)R[n] >= 0)
+		ans = 0;
+	else
+		ans = 1;
+
+	ans += dest;
+
+	if (src == 1)
+	{
+		if (ans == 1)
+			SR.T = 1;
+		else
+			SR.T = 0;
+	}
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// and Rm,Rn
+template <> inline void Interpreter::execute<76>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] &= R[m];
+	PC += 2;
+}
+
+// and #imm,R0
+template <> inline void Interpreter::execute<77>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	R[0] &= (0x000000FF & (int32_t)i);
+	PC += 2;
+}
+
+// and.b #imm,@(R0,GBR)
+template <> inline void Interpreter::execute<78>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	int32_t temp = Read_8 (GBR + R[0]);
+	temp &= 0x000000FF & (int32_t)i;
+	Write_8 (GBR + R[0], temp);
+	PC += 2;
+}
+
+// not Rm,Rn
+template <> inline void Interpreter::execute<79>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] = ~R[m];
+	PC += 2;
+}
+
+// or Rm,Rn
+template <> inline void Interpreter::execute<80>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] |= R[m];
+	PC += 2;
+}
+
+// or #imm,R0
+template <> inline void Interpreter::execute<81>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	R[0] |= (0x000000FF & (int32_t)i);
+	PC += 2;
+}
+
+// or.b #imm,@(R0,GBR)
+template <> inline void Interpreter::execute<82>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	int32_t temp = Read_8 (GBR + R[0]);
+	temp |= (0x000000FF & (int32_t)i);
+	Write_8 (GBR + R[0], temp);
+	PC += 2;
+}
+
+// tas.b @Rn
+template <> inline void Interpreter::execute<83>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	int temp = Read_8 (R[n]); // Bus Lock
+
+	if (temp == 0)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	temp |= 0x00000080;
+	Write_8 (R[n], temp);  // Bus unlock
+	PC += 2;
+}
+
+// tst Rm,Rn
+template <> inline void Interpreter::execute<84>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	if ((R[n] & R[m]) == 0)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// tst #imm,R0
+template <> inline void Interpreter::execute<85>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	int32_t temp = R[0] & (0x000000FF & (int32_t)i);
+
+	if (temp == 0)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// tst.b #imm,@(R0,GBR)
+template <> inline void Interpreter::execute<86>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	int32_t temp = Read_8 (GBR + R[0]);
+	temp &= (0x000000FF & (int32_t)i);
+
+	if (temp == 0)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// xor Rm,Rn
+template <> inline void Interpreter::execute<87>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	R[n] ^= R[m];
+	PC += 2;
+}
+
+// xor #imm,R0
+template <> inline void Interpreter::execute<88>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	R[0] ^= (0x000000FF & (int32_t)i);
+	PC += 2;
+}
+
+// xor.b #imm,@(R0,GBR)
+template <> inline void Interpreter::execute<89>(uint16_t code)
+{
+	const int i = code & 0xFF;
+
+	int temp = Read_8 (GBR + R[0]);
+	temp ^= (0x000000FF & (int32_t)i);
+	Write_8 (GBR + R[0], temp);
+	PC += 2;
+}
+
+// rotcl Rn
+template <> inline void Interpreter::execute<90>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	int32_t temp;
+
+	if ((R[n] & 0x80000000) == 0)
+		temp = 0;
+	else
+		temp = 1;
+
+	R[n] <<= 1;
+
+	if (SR.T == 1)
+		R[n] |= 0x00000001;
+	else
+		R[n] &= 0xFFFFFFFE;
+
+	if (temp == 1)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// rotcr Rn
+template <> inline void Interpreter::execute<91>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	int32_t temp;
+
+	if ((R[n] & 0x00000001) == 0)
+		temp = 0;
+	else
+		temp = 1;
+
+	R[n] >>= 1;
+
+	if (SR.T == 1)
+		R[n] |= 0x80000000;
+	else
+		R[n] &= 0x7FFFFFFF;
+
+	if (temp == 1)
+		SR.T = 1;
+	else
+		SR.T = 0;
+
+	PC += 2;
+}
+
+// rotl Rn
+template <> inline void Interpreter::execute<92>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if ((R[n] & 0x80000000) == 0)
+		SR.T = 0;
+	else
+		SR.T = 1;
+
+	R[n] <<= 1;
+
+	if (SR.T == 1)
+		R[n] |= 0x00000001;
+	else
+		R[n] &= 0xFFFFFFFE;
+
+	PC += 2;
+}
+
+// rotr Rn
+template <> inline void Interpreter::execute<93>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if ((R[n] & 0x00000001) == 0)
+		SR.T = 0;
+	else
+		SR.T = 1;
+
+	R[n] >>= 1;
+
+	if (SR.T == 1)
+		R[n] |= 0x80000000;
+	else
+		R[n] &= 0x7FFFFFFF;
+
+	PC += 2;
+}
+
+// shad Rm,Rn
+template <> inline void Interpreter::execute<94>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	int sgn = R[m] & 0x80000000;
+
+	if (sgn == 0)
+		R[n] <<= (R[m] & 0x1F);
+	else if ((R[m] & 0x1F) == 0)
+	{
+		if ((R[n] & 0x80000000) == 0)
+			R[n] = 0;
+		else
+			R[n] = 0xFFFFFFFF;
+	}
+	else
+		R[n] = (int32_t)R[n] >> ((~R[m] & 0x1F) + 1);
+
+	PC += 2;
+}
+
+// shal Rn
+template <> inline void Interpreter::execute<95>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if ((R[n] & 0x80000000) == 0)
+		SR.T = 0;
+	else
+		SR.T = 1;
+
+	R[n] <<= 1;
+	PC += 2;
+}
+
+// shar Rn
+template <> inline void Interpreter::execute<96>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	int32_t temp;
+
+	if ((R[n] & 0x00000001) == 0)
+		SR.T = 0;
+	else
+		SR.T = 1;
+
+	if ((R[n] & 0x80000000) == 0)
+		temp = 0;
+	else
+		temp = 1;
+
+	R[n] >>= 1;
+
+	if (temp == 1)
+		R[n] |= 0x80000000;
+	else
+		R[n] &= 0x7FFFFFFF;
+
+	PC += 2;
+}
+
+// shld Rm,Rn
+template <> inline void Interpreter::execute<97>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	int sgn = R[m] & 0x80000000;
+
+	if (sgn == 0)
+		R[n] <<= (R[m] & 0x1F);
+	else if ((R[m] & 0x1F) == 0)
+		R[n] = 0;
+	else
+		R[n] = (uint32_t)R[n] >> ((~R[m] & 0x1F) + 1);
+
+	PC += 2;
+}
+
+// shll Rn
+template <> inline void Interpreter::execute<98>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if ((R[n] & 0x80000000) == 0)
+		SR.T = 0;
+	else
+		SR.T = 1;
+
+	R[n] <<= 1;
+	PC += 2;
+}
+
+// shll2 Rn
+template <> inline void Interpreter::execute<99>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] <<= 2;
+	PC += 2;
+}
+
+// shll8 Rn
+template <> inline void Interpreter::execute<100>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] <<= 8;
+	PC += 2;
+}
+
+// shll16 Rn
+template <> inline void Interpreter::execute<101>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] <<= 16;
+	PC += 2;
+}
+
+// shlr Rn
+template <> inline void Interpreter::execute<102>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if ((R[n] & 0x00000001) == 0)
+		SR.T = 0;
+	else
+		SR.T = 1;
+
+	R[n] >>= 1;
+	R[n] &= 0x7FFFFFFF;
+	PC += 2;
+}
+
+// shlr2 Rn
+template <> inline void Interpreter::execute<103>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] >>= 2;
+	R[n] &= 0x3FFFFFFF;
+	PC += 2;
+}
+
+// shlr8 Rn
+template <> inline void Interpreter::execute<104>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] >>= 8;
+	R[n] &= 0x00FFFFFF;
+	PC += 2;
+}
+
+// shlr16 Rn
+template <> inline void Interpreter::execute<105>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] >>= 16;
+	R[n] &= 0x0000FFFF;
+	PC += 2;
+}
+
+// bf label
+template <> inline void Interpreter::execute<106>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	int disp;
+	if ((d & 0x80) == 0)
+		disp = (0x000000FF & d);
+	else
+		disp = (0xFFFFFF00 | d);
+
+	if (SR.T == 0)
+		PC = PC + 4 + (disp << 1);
+	else
+		PC += 2;
+}
+
+// bf/s label
+template <> inline void Interpreter::execute<107>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	int disp;
+	uint32_t temp;
+	temp = PC;
+	if ((d & 0x80) == 0)
+		disp = (0x000000FF & d);
+	else
+		disp = (0xFFFFFF00 | d);
+
+	if (SR.T == 0)
+		PC = PC + 4 + (disp << 1);
+	else
+		PC += 4;
+
+	Delay_Slot (temp + 2);
+}
+
+// bt label
+template <> inline void Interpreter::execute<108>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	int disp;
+	if ((d & 0x80) == 0)
+		disp = (0x000000FF & d);
+	else
+		disp = (0xFFFFFF00 | d);
+
+	if (SR.T == 1)
+		PC = PC + 4 + (disp << 1);
+	else
+		PC += 2;
+}
+
+// bt/s label
+template <> inline void Interpreter::execute<109>(uint16_t code)
+{
+	const int d = code & 0xFF;
+
+	int disp;
+	uint32_t temp;
+	temp = PC;
+
+	if ((d & 0x80) == 0)
+		disp = (0x000000FF & d);
+	else
+		disp = (0xFFFFFF00 | d);
+
+	if (SR.T == 1)
+		PC = PC + 4 + (disp << 1);
+	else
+		PC += 4;
+
+	Delay_Slot (temp + 2);
+}
+
+// bra label
+template <> inline void Interpreter::execute<110>(uint16_t code)
+{
+	const int d = code & 0xFFF;
+
+	int disp;
+	uint32_t temp;
+	temp = PC;
+
+	if ((d & 0x800) == 0)
+		disp = (0x00000FFF & d);
+	else
+		disp = (0xFFFFF000 | d);
+
+	PC = PC + 4 + (disp << 1);
+	Delay_Slot(temp + 2);
+}
+
+// braf Rm
+template <> inline void Interpreter::execute<111>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	uint32_t temp;
+	temp = PC;
+	PC = PC + 4 + R[m];
+	Delay_Slot (temp + 2);
+}
+
+// bsr label
+template <> inline void Interpreter::execute<112>(uint16_t code)
+{
+	const int d = code & 0xFFF;
+
+	int disp;
+	uint32_t temp;
+	temp = PC;
+
+	if ((d & 0x800) == 0)
+		disp = (0x00000FFF & d);
+	else
+		disp = (0xFFFFF000 | d);
+
+	PR = PC + 4;
+	PC = PC + 4 + (disp << 1);
+	Delay_Slot (temp + 2);
+}
+
+// bsrf Rm
+template <> inline void Interpreter::execute<113>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	uint32_t temp;
+	temp = PC;
+	PR = PC + 4;
+	PC = PC + 4 + R[m];
+	Delay_Slot (temp + 2);
+}
+
+// jmp @Rm
+template <> inline void Interpreter::execute<114>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	uint32_t temp;
+	temp = PC;
+	PC = R[m];
+	Delay_Slot (temp + 2);
+}
+
+// jsr @Rm
+template <> inline void Interpreter::execute<115>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	uint32_t temp;
+	temp = PC;
+	PR = PC + 4;
+	PC = R[m];
+	Delay_Slot (temp + 2);
+}
+
+// rts
+template <> inline void Interpreter::execute<116>(uint16_t)
+{
+	uint32_t temp;
+	temp = PC;
+	PC = PR;
+	Delay_Slot (temp + 2);
+}
+
+// clrmac
+template <> inline void Interpreter::execute<117>(uint16_t)
+{
+	MACH = 0;
+	MACL = 0;
+	PC += 2;
+}
+
+// clrs
+template <> inline void Interpreter::execute<118>(uint16_t)
+{
+	SR.S = 0;
+	PC += 2;
+}
+
+// clrt
+template <> inline void Interpreter::execute<119>(uint16_t)
+{
+	SR.T = 0;
+	PC += 2;
+}
+
+// icbi @Rn
+template <> inline void Interpreter::execute<120>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	invalidate_instruction_cache_block (R[n]);
+	PC += 2;
+}
+
+// ldc Rm,SR
+template <> inline void Interpreter::execute<121>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SR = R[m] & 0x700083F3;
+
+
+	PC += 2;
+}
+
+// ldc.l @Rm+,SR
+template <> inline void Interpreter::execute<122>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SR = Read_32 (R[m]) & 0x700083F3;
+
+
+	R[m] += 4;
+	PC += 2;
+}
+
+// ldc Rm,GBR
+template <> inline void Interpreter::execute<123>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	GBR = R[m];
+	PC += 2;
+}
+
+// ldc.l @Rm+,GBR
+template <> inline void Interpreter::execute<124>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	GBR = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// ldc Rm,VBR
+template <> inline void Interpreter::execute<125>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	VBR = R[m];
+	PC += 2;
+}
+
+// ldc.l @Rm+,VBR
+template <> inline void Interpreter::execute<126>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	VBR = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// ldc Rm,SGR
+template <> inline void Interpreter::execute<127>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SGR = R[m];
+	PC += 2;
+}
+
+// ldc.l @Rm+,SGR
+template <> inline void Interpreter::execute<128>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SGR = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// ldc Rm,SSR
+template <> inline void Interpreter::execute<129>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SSR = R[m],
+	PC += 2;
+}
+
+// ldc.l @Rm+,SSR
+template <> inline void Interpreter::execute<130>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SSR = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// ldc Rm,SPC
+template <> inline void Interpreter::execute<131>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SPC = R[m];
+	PC += 2;
+}
+
+// ldc.l @Rm+,SPC
+template <> inline void Interpreter::execute<132>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	SPC = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// ldc Rm,DBR
+template <> inline void Interpreter::execute<133>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	DBR = R[m];
+	PC += 2;
+}
+
+// ldc.l @Rm+,DBR
+template <> inline void Interpreter::execute<134>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	DBR = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// lds Rm,MACH
+template <> inline void Interpreter::execute<137>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	MACH = R[m];
+
+
+	PC += 2;
+}
+
+// lds.l @Rm+,MACH
+template <> inline void Interpreter::execute<138>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	MACH = Read_32 (R[m]);
+
+
+	R[m] += 4;
+	PC += 2;
+}
+
+// lds Rm,MACL
+template <> inline void Interpreter::execute<139>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	MACL = R[m];
+	PC += 2;
+}
+
+// lds.l @Rm+,MACL
+template <> inline void Interpreter::execute<140>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	MACL = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// lds Rm,PR
+template <> inline void Interpreter::execute<141>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	PR = R[m];
+	PC += 2;
+}
+
+// lds.l @Rm+,PR
+template <> inline void Interpreter::execute<142>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	PR = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// movca.l R0,@Rn
+template <> inline void Interpreter::execute<144>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if (is_write_back_memory (R[n]) && look_up_in_operand_cache (R[n]) == MISS)
+		allocate_operand_cache_block (R[n]);
+
+	Write_32 (R[n], R[0]);
+	PC += 2;
+}
+
+// nop
+template <> inline void Interpreter::execute<145>(uint16_t)
+{
+	PC += 2;
+}
+
+// ocbi @Rn
+template <> inline void Interpreter::execute<146>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	invalidate_operand_cache_block (R[n]);
+	PC += 2;
+}
+
+// ocbp @Rn
+template <> inline void Interpreter::execute<147>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if (is_dirty_block (R[n]))
+		write_back (R[n]);
+
+	invalidate_operand_cache_block (R[n]);
+	PC += 2;
+}
+
+// ocbwb @Rn
+template <> inline void Interpreter::execute<148>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	if (is_dirty_block (R[n]))
+		write_back (R[n]);
+
+	PC += 2;
+}
+
+// pref @Rn
+template <> inline void Interpreter::execute<149>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	prefetch_operand_cache_block (R[n]);
+	PC += 2;
+}
+
+// prefi @Rn
+template <> inline void Interpreter::execute<150>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	prefetch_instruction_cache_block (R[n]);
+	PC += 2;
+}
+
+// rte
+template <> inline void Interpreter::execute<151>(uint16_t)
+{
+	uint32_t temp = PC;
+
+	SR = SSR;
+	PC = SPC;
+
+
+	Delay_Slot (temp + 2);
+}
+
+// sets
+template <> inline void Interpreter::execute<152>(uint16_t)
+{
+	SR.S = 1;
+	PC += 2;
+}
+
+// sett
+template <> inline void Interpreter::execute<153>(uint16_t)
+{
+	SR.T = 1;
+	PC += 2;
+}
+
+// sleep
+template <> inline void Interpreter::execute<154>(uint16_t)
+{
+	Sleep_standby();
+}
+
+// stc SR,Rn
+template <> inline void Interpreter::execute<155>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = SR;
+	PC += 2;
+}
+
+// stc.l SR,@-Rn
+template <> inline void Interpreter::execute<156>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], SR);
+	PC += 2;
+}
+
+// stc GBR,Rn
+template <> inline void Interpreter::execute<157>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = GBR;
+	PC += 2;
+}
+
+// stc.l GBR,@-Rn
+template <> inline void Interpreter::execute<158>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], GBR);
+	PC += 2;
+}
+
+// stc VBR,Rn
+template <> inline void Interpreter::execute<159>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = VBR;
+	PC += 2;
+}
+
+// stc.l VBR,@-Rn
+template <> inline void Interpreter::execute<160>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], VBR);
+	PC += 2;
+}
+
+// stc SGR,Rn
+template <> inline void Interpreter::execute<161>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = SGR;
+	PC += 2;
+}
+
+// stc.l SGR,@-Rn
+template <> inline void Interpreter::execute<162>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], SGR);
+	PC += 2;
+}
+
+// stc SSR,Rn
+template <> inline void Interpreter::execute<163>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = SSR;
+	PC += 2;
+}
+
+// stc.l SSR,@-Rn
+template <> inline void Interpreter::execute<164>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], SSR);
+	PC += 2;
+}
+
+// stc SPC,Rn
+template <> inline void Interpreter::execute<165>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = SPC;
+	PC += 2;
+}
+
+// stc.l SPC,@-Rn
+template <> inline void Interpreter::execute<166>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], SPC);
+	PC += 2;
+}
+
+// stc DBR,Rn
+template <> inline void Interpreter::execute<167>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = DBR;
+	PC += 2;
+}
+
+// stc.l DBR,@-Rn
+template <> inline void Interpreter::execute<168>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], DBR);
+	PC += 2;
+}
+
+// sts MACH,Rn
+template <> inline void Interpreter::execute<171>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = MACH;
+
+
+	PC += 2;
+}
+
+// sts.l MACH,@-Rn
+template <> inline void Interpreter::execute<172>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+
+	Write_32 (R[n], MACH);
+
+
+	PC += 2;
+}
+
+// sts MACL,Rn
+template <> inline void Interpreter::execute<173>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = MACL;
+	PC += 2;
+}
+
+// sts.l MACL,@-Rn
+template <> inline void Interpreter::execute<174>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], MACL);
+	PC += 2;
+}
+
+// sts PR,Rn
+template <> inline void Interpreter::execute<175>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = PR;
+	PC += 2;
+}
+
+// sts.l PR,@-Rn
+template <> inline void Interpreter::execute<176>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], PR);
+	PC += 2;
+}
+
+// fmov FRm,FRn
+template <> inline void Interpreter::execute<179>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	FR[n] = FR[m];
+	PC += 2;
+}
+
+// fmov.s @Rm,FRn
+template <> inline void Interpreter::execute<180>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	FR[n] = Read_32 (R[m]);
+	PC += 2;
+}
+
+// fmov.s FRm,@Rn
+template <> inline void Interpreter::execute<181>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_32 (R[n], FR[m]);
+	PC += 2;
+}
+
+// fmov.s @Rm+,FRn
+template <> inline void Interpreter::execute<182>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	FR[n] = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// fmov.s FRm,@-Rn
+template <> inline void Interpreter::execute<183>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_32 (R[n] - 4, FR[m]);
+	R[n] -= 4;
+	PC += 2;
+}
+
+// fmov.s @(R0,Rm),FRn
+template <> inline void Interpreter::execute<184>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	FR[n] = Read_32 (R[0] + R[m]);
+	PC += 2;
+}
+
+// fmov.s FRm,@(R0,Rn)
+template <> inline void Interpreter::execute<185>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+	const int m = (code >> 4) & 0xF;
+
+	Write_32 (R[0] + R[n], FR[m]);
+	PC += 2;
+}
+
+// fldi0 FRn
+template <> inline void Interpreter::execute<202>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	FR[n] = 0x00000000;
+	PC += 2;
+}
+
+// fldi1 FRn
+template <> inline void Interpreter::execute<203>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	FR[n] = 0x3F800000;
+	PC += 2;
+}
+
+// flds FRm,FPUL
+template <> inline void Interpreter::execute<204>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	FPUL = FR[m];
+	PC += 2;
+}
+
+// fsts FPUL,FRn
+template <> inline void Interpreter::execute<205>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	FR[n] = FPUL;
+	PC += 2;
+}
+
+// fabs FRn
+template <> inline void Interpreter::execute<206>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	FR[n] = FR[n] & 0x7FFFFFFFF;
+	PC += 2;
+}
+
+// fneg FRn
+template <> inline void Interpreter::execute<207>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	FR[n] = FR[n] ^ 0x80000000;
+	PC += 2;
+}
+
+// fabs DRn
+template <> inline void Interpreter::execute<222>(uint16_t code)
+{
+	const int n = (code >> 9) & 0x7;
+
+	FR[n] = FR[n] & 0x7FFFFFFFF;
+	PC += 2;
+}
+
+// fneg DRn
+template <> inline void Interpreter::execute<223>(uint16_t code)
+{
+	const int n = (code >> 9) & 0x7;
+
+	FR[n] = FR[n] ^ 0x80000000;
+	PC += 2;
+}
+
+// lds Rm,FPSCR
+template <> inline void Interpreter::execute<235>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	FPSCR = R[m] & 0x003FFFFF;
+
+
+	PC += 2;
+}
+
+// sts FPSCR,Rn
+template <> inline void Interpreter::execute<236>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = FPSCR & 0x003FFFFF;
+
+
+	PC += 2;
+}
+
+// lds.l @Rm+,FPSCR
+template <> inline void Interpreter::execute<237>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	FPSCR = Read_32 (R[m]) & 0x003FFFFF;
+
+
+	R[m] += 4;
+	PC += 2;
+}
+
+// sts.l FPSCR,@-Rn
+template <> inline void Interpreter::execute<238>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+
+	Write_32 (R[n], FPSCR & 0x003FFFFF);
+
+
+	PC += 2;
+}
+
+// lds Rm,FPUL
+template <> inline void Interpreter::execute<239>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	FPUL = R[m];
+	PC += 2;
+}
+
+// sts FPUL,Rn
+template <> inline void Interpreter::execute<240>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] = FPUL;
+	PC += 2;
+}
+
+// lds.l @Rm+,FPUL
+template <> inline void Interpreter::execute<241>(uint16_t code)
+{
+	const int m = (code >> 8) & 0xF;
+
+	FPUL = Read_32 (R[m]);
+	R[m] += 4;
+	PC += 2;
+}
+
+// sts.l FPUL,@-Rn
+template <> inline void Interpreter::execute<242>(uint16_t code)
+{
+	const int n = (code >> 8) & 0xF;
+
+	R[n] -= 4;
+	Write_32 (R[n], FPUL);
+	PC += 2;
+}
+
+// frchg
+template <> inline void Interpreter::execute<243>(uint16_t)
+{
+	if (((FPSCR >> 19) & 1) == 0)
+	{
+		FPSCR ^= 0x00200000;  // toggle bit 21
+		PC += 2;
+	}
+	else
+		undefined_operation ();
+}
+
+// fschg
+template <> inline void Interpreter::execute<244>(uint16_t)
+{
+	if (((FPSCR >> 19) & 1) == 0)
+	{
+		FPSCR ^= 0x00100000;  // toggle bit 20
+		PC += 2;
+	}
+	else
+		undefined_operation ();
+}
+
+// fpchg
+template <> inline void Interpreter::execute<245>(uint16_t)
+{
+	FPSCR ^= 0x00080000;  // toggle bit 19
+	PC += 2;
+}
+
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <span>
+#include <bit>
+#include <algorithm>
+
+#include "decoder.h"
+
+// rough static timing for straight line SH4 code. it models dual issue
+// pairing and stalls on registers that aren't ready yet, it doesn't know about
+// caches, the store queue or branch penalties so treat it as a lower bound
+
+// one bit per register or flag an instruction can depend on
+enum : int
+{
+	resourceR0 = 0,
+	resourceFr0 = 16,
+	resourceFpul = 32,
+	resourceMac,
+	resourcePr,
+	resourceGbr,
+	resourceT,
+	resourceFpscr,
+	resourceCount,
+};
+
+struct Operands
+{
+	enum class Kind : uint8_t
+	{
+		None,
+		R,
+		Fr,
+		Dr,
+	};
+
+	// one per %d/%X in the decode string, in the same order as the printf args
+	Kind kinds[4]{};
+	bool reads[4]{};
+	bool writes[4]{};
+
+	// registers named in the decode string itself (R0, FPUL..) and flags
+	uint64_t fixedReads{};
+	uint64_t fixedWrites{};
+};
+
+constexpr bool startsWith(const char* string, const char* prefix)
+{
+	for (; *prefix; string++, prefix++)
+		if (*string != *prefix)
+			return false;
+
+	return true;
+}
+
+constexpr bool isLetter(char c)
+{
+	return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+// registers the decode string spells out instead of printing
+constexpr uint64_t getNamedResource(const char* token)
+{
+	if (startsWith(token, "R0"))
+		return 1ull << resourceR0;
+
+	if (startsWith(token, "FR0"))
+		return 1ull << resourceFr0;
+
+	if (startsWith(token, "FPUL"))
+		return 1ull << resourceFpul;
+
+	if (startsWith(token, "MACH") || startsWith(token, "MACL"))
+		return 1ull << resourceMac;
+
+	if (startsWith(token, "PR") && !isLetter(token[2]))
+		return 1ull << resourcePr;
+
+	if (startsWith(token, "GBR"))
+		return 1ull << resourceGbr;
+
+	if (startsWith(token, "FPSCR"))
+		return 1ull << resourceFpscr;
+
+	return 0;
+}
+
+// works out what every operand is from the decode string. the last operand is
+// the destination, anything behind an @ is only read for the address unless
+// it's pre decremented or post incremented
+constexpr Operands parseOperands(const char* decodeString)
+{
+	Operands operands;
+
+	const auto is = [&](const char* mnemonic) { return mnemonicIs(decodeString, mnemonic); };
+	const auto startsAs = [&](const char* prefix) { return startsWith(decodeString, prefix); };
+
+	// the destination is written without being read first
+	const bool moveOnly =
+		startsAs("mov") || startsAs("fmov") || startsAs("lds") || startsAs("sts") || startsAs("ldc") || startsAs("stc") ||
+		startsAs("ext") || startsAs("swap") || startsAs("fcnv") || is("neg") || is("negc") || is("not") ||
+		is("float") || is("ftrc") || is("flds") || is("fsts") || is("fldi0") || is("fldi1");
+
+	// the destination is only read, the result goes to T (or the pc)
+	const bool readOnly = startsAs("cmp") || startsAs("fcmp") || is("tst") || is("tst.b") || is("braf") || is("bsrf");
+
+	const char* args = decodeString;
+
+	while (*args && *args != ' ')
+		args++;
+
+	while (*args == ' ')
+		args++;
+
+	int operandCount = *args ? 1 : 0;
+
+	for (int i = 0, depth = 0; args[i]; i++)
+	{
+		depth += args[i] == '(' ? 1 : args[i] == ')' ? -1 : 0;
+
+		if (depth == 0 && startsWith(args + i, " -> "))
+			operandCount++;
+	}
+
+	int operand = 0;
+	int field = 0;
+	int depth = 0;
+	bool memory = false;
+
+	for (int i = 0; args[i];)
+	{
+		const char* token = args + i;
+		const char previous = i ? args[i - 1] : ' ';
+
+		if (depth == 0 && startsWith(token, " -> "))
+		{
+			operand++;
+			memory = false;
+			i += 4;
+			continue;
+		}
+
+		const bool destination = operand == operandCount - 1;
+		const bool read = memory || !destination || !moveOnly;
+		const bool write = !memory && destination && !readOnly;
+
+		uint64_t fixed{};
+
+		if (*token == '(')
+			depth++;
+		else if (*token == ')')
+			depth--;
+		else if (*token == '@')
+			memory = true;
+
+		if (startsWith(token, "r[%d]"))
+		{
+			auto kind = previous == 'F' ? Operands::Kind::Fr : previous == 'D' ? Operands::Kind::Dr : Operands::Kind::R;
+
+			if (startsWith(token + 5, "_BANK"))
+				kind = Operands::Kind::None;
+
+			if (field < 4)
+			{
+				operands.kinds[field] = kind;
+				operands.reads[field] = read;
+				operands.writes[field] = write || (memory && (previous == '-' || token[5] == '+'));
+			}
+
+			field++;
+			i += 5;
+			continue;
+		}
+		else if (*token == '%')
+		{
+			field++;
+
+			while (args[++i] && !isLetter(args[i]))
+				;
+
+			i++;
+			continue;
+		}
+		else if (!isLetter(previous))
+			fixed = getNamedResource(token);
+
+		if (read)
+			operands.fixedReads |= fixed;
+
+		if (write)
+			operands.fixedWrites |= fixed;
+
+		i++;
+	}
+
+	// things the decode string doesn't mention
+	constexpr uint64_t t = 1ull << resourceT;
+	constexpr uint64_t mac = 1ull << resourceMac;
+	constexpr uint64_t pr = 1ull << resourcePr;
+
+	if (startsAs("cmp") || startsAs("fcmp") || is("tst") || is("tst.b") || is("dt") || is("tas.b") ||
+		is("shll") || is("shlr") || is("shal") || is("shar") || is("rotl") || is("rotr") ||
+		is("div0s") || is("div0u") || is("clrt") || is("sett") || is("addv") || is("subv"))
+		operands.fixedWrites |= t;
+
+	if (is("bt") || is("bf") || is("bt/s") || is("bf/s") || is("movt"))
+		operands.fixedReads |= t;
+
+	if (is("addc") || is("subc") || is("negc") || is("rotcl") || is("rotcr") || is("div1"))
+	{
+		operands.fixedReads |= t;
+		operands.fixedWrites |= t;
+	}
+
+	if (is("mac.l") || is("mac.w"))
+		operands.fixedReads |= mac;
+
+	if (is("mac.l") || is("mac.w") || is("mul.l") || is("muls.w") || is("mulu.w") || is("dmuls.l") || is("dmulu.l") || is("clrmac"))
+		operands.fixedWrites |= mac;
+
+	if (is("bsr") || is("bsrf") || is("jsr"))
+		operands.fixedWrites |= pr;
+
+	if (is("rts"))
+		operands.fixedReads |= pr;
+
+	return operands;
+}
+
+constexpr auto buildOperandTable()
+{
+	std::array<Operands, Decoder::instructionCount> operands{};
+
+	for (size_t i = 0; i < operands.size(); i++)
+		operands[i] = parseOperands(Decoder::instructions[i].decodeString);
+
+	return operands;
+}
+
+inline constexpr auto instructionOperands = buildOperandTable();
+
+struct Resources
+{
+	uint64_t reads{};
+	uint64_t writes{};
+};
+
+inline Resources getResources(DecodedInst inst)
+{
+	const auto& operands = instructionOperands[inst.id];
+	const uint32_t fields[4]{ inst.field0, inst.field1, inst.field2, inst.field3 };
+
+	Resources resources{ operands.fixedReads, operands.fixedWrites };
+
+	for (int i = 0; i < Decoder::instructions[inst.id].layout.count; i++)
+	{
+		const auto value = fields[i];
+
+		uint64_t bits{};
+
+		switch (operands.kinds[i])
+		{
+		case Operands::Kind::R:  bits = 1ull << (resourceR0 + value); break;
+		case Operands::Kind::Fr: bits = 1ull << (resourceFr0 + value); break;
+		case Operands::Kind::Dr: bits = 3ull << (resourceFr0 + value * 2); break;
+		default: break;
+		}
+
+		if (operands.reads[i])
+			resources.reads |= bits;
+
+		if (operands.writes[i])
+			resources.writes |= bits;
+	}
+
+	return resources;
+}
+
+// which groups can issue in the same cycle, from the SH7750 manual. CO never
+// pairs, MT pairs with anything else and the rest only with a different group
+constexpr bool canDualIssue(Decoder::Group first, Decoder::Group second)
+{
+	using Group = Decoder::Group;
+
+	if (first == Group::CO || second == Group::CO)
+		return false;
+
+	if (first == Group::MT || second == Group::MT)
+		return true;
+
+	return first != second;
+}
+
+struct BlockTiming
+{
+	uint64_t cycles{};
+	uint64_t stallCycles{};	// spent waiting on a register
+	uint64_t pairs{};		// instructions that issued alongside the one before
+};
+
+inline BlockTiming estimateCycles(std::span<const DecodedInst> block)
+{
+	using Group = Decoder::Group;
+
+	BlockTiming timing;
+	uint64_t ready[resourceCount]{};	// cycle each register can next be read on
+	uint64_t nextIssue{};
+
+	// the previous instruction, while the second slot of its cycle is still free
+	bool pairOpen{};
+	uint64_t pairCycle{};
+	Group pairGroup{};
+	uint64_t pairWrites{};
+
+	for (const auto decoded : block)
+	{
+		const auto& inst = Decoder::instructions[decoded.id];
+		const auto resources = getResources(decoded);
+
+		// anything without timings (including unknown words) is treated as a one cycle CO
+		const auto group = inst.group == Group::None ? Group::CO : inst.group;
+		const uint64_t issueCycles = std::max<uint64_t>(inst.issueCycles, 1);
+		const uint64_t latencyCycles = std::max<uint64_t>(inst.latencyCycles, 1);
+
+		uint64_t operandsReady{};
+
+		for (auto reads = resources.reads; reads; reads &= reads - 1)
+			operandsReady = std::max(operandsReady, ready[std::countr_zero(reads)]);
+
+		uint64_t cycle{};
+
+		if (pairOpen && issueCycles == 1 && operandsReady <= pairCycle && canDualIssue(pairGroup, group) && !(resources.writes & pairWrites))
+		{
+			cycle = pairCycle;
+			pairOpen = false;
+			timing.pairs++;
+		}
+		else
+		{
+			cycle = std::max(nextIssue, operandsReady);
+			timing.stallCycles += cycle - nextIssue;
+
+			pairOpen = issueCycles == 1 && group != Group::CO;
+			pairCycle = cycle;
+			pairGroup = group;
+			pairWrites = resources.writes;
+
+			nextIssue = cycle + issueCycles;
+		}
+
+		for (auto writes = resources.writes; writes; writes &= writes - 1)
+			ready[std::countr_zero(writes)] = cycle + latencyCycles;
+	}
+
+	timing.cycles = nextIssue;
+
+	return timing;
+}
@@ -0,0 +1,506 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <iterator>
+#include <array>
+#include <bit>
+#include <span>
+#include <algorithm>
+
+#include "decompsh.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define DECOMPSH_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define DECOMPSH_TARGET(isa) __attribute__((target(isa)))
+#else
+#define DECOMPSH_TARGET(isa)
+#endif
+
+// the vector extensions this machine has, for picking kernels at run time
+struct CpuFeatures
+{
+	bool avx2{};	// only if the OS also saves the ymm registers
+};
+
+inline const CpuFeatures& getCpuFeatures()
+{
+	static const CpuFeatures features = []
+	{
+		CpuFeatures result;
+
+#if DECOMPSH_X86 && defined(_MSC_VER) && !defined(__clang__)
+		int info[4]{};
+		__cpuid(info, 1);
+
+		const bool osAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+
+		__cpuidex(info, 7, 0);
+		result.avx2 = osAvx && (info[1] & (1 << 5));
+#elif DECOMPSH_X86
+		__builtin_cpu_init();
+
+		result.avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+		return result;
+	}();
+
+	return features;
+}
+
+using decompsh::DecodedInst;
+
+struct Decoder
+{
+	// 'shift' is worked out from the mask at compile time
+	struct DataOffset
+	{
+		int size{};
+		uint16_t mask{};
+		int shift{};
+
+		constexpr DataOffset() = default;
+		constexpr DataOffset(int size, uint16_t mask) :
+			size(size), mask(mask), shift(0)
+		{
+			while (mask && !((mask >> shift) & 1))
+				shift++;
+		}
+	};
+
+	struct Layout
+	{
+		DataOffset dataOffsets[3]{};
+		int count{};
+
+		constexpr Layout() = default;
+		constexpr Layout(DataOffset a) : dataOffsets{ a }, count(1) {}
+		constexpr Layout(DataOffset a, DataOffset b) : dataOffsets{ a, b }, count(2) {}
+		constexpr Layout(DataOffset a, DataOffset b, DataOffset c) : dataOffsets{ a, b, c }, count(3) {}
+	};
+
+	// SH4 issue groups, two instructions can only issue together in certain
+	// combinations of these (see cycles.h)
+	enum class Group : uint8_t
+	{
+		None,
+		MT,
+		EX,
+		BR,
+		LS,
+		FE,
+		CO,
+	};
+
+	struct Inst
+	{
+		const char* decodeString;
+		uint16_t op{};
+		uint16_t decodingMask{};
+		Layout layout{};
+		Group group{};
+		uint8_t issueCycles{};
+		uint8_t latencyCycles{};
+		bool valid{ true };
+		
+		// writes into the callers buffer so any number of threads can format at once
+		int getDissasembledString(uint16_t inst, char* dstString, size_t dstSize) const
+		{
+			unsigned int vals[4]{};
+
+			for (int i = 0; i < layout.count; i++)
+			{
+				const auto& data = layout.dataOffsets[i];
+				vals[i] = (inst & data.mask) >> data.shift;
+			}
+
+			// exploit the fact that sprintf ignores unused parameters!!!
+			return snprintf(dstString, dstSize,
+				decodeString, 
+				vals[0], vals[1], vals[2], vals[3]
+			);
+		}
+	};
+
+	static const Inst instructions[];
+	static const size_t instructionCount;
+
+	// maps every possible 16 bit opcode straight to its index in 'instructions'.
+	// there is one spare slot on the end so a 32 bit gather can read the last entry
+	static const std::array<uint16_t, 0x10000 + 1> dispatch;
+
+	const Inst& decode(uint16_t inst) const
+	{
+		return instructions[dispatch[inst]];
+	}
+
+	// writes the index into 'instructions' for each of the 'n' words, picking the
+	// widest SIMD kernel the cpu supports. 'swapBytes' is for big endian hosts or
+	// images that were dumped with the halfwords swapped
+	static void decodeBatch(const uint16_t* in, size_t n, uint16_t* opIds, bool swapBytes = std::endian::native == std::endian::big);
+
+	// decodes min(words.size(), out.size()) words into packed records
+	static void decode(std::span<const uint16_t> words, std::span<DecodedInst> out, bool swapBytes = std::endian::native == std::endian::big);
+
+	static constexpr DecodedInst pack(uint16_t opId, uint16_t inst);
+
+	// the packed record for every possible opcode, so decode() is one load per word
+	static const std::array<DecodedInst, 0x10000> decodedTable;
+
+	// renders the text for a decoded word, only done when something wants to read it
+	static int format(DecodedInst inst, char* dstString, size_t dstSize);
+};
+
+#define BITPACK(nib1, nib2, nib3, nib4) 0b##nib1##nib2##nib3##nib4
+
+// the descriptors are in right to left order...
+// I'm not sure why.. I should check
+inline constexpr Decoder::Layout ____nnnnmmmm____{ { 4, 0x00F0 }, { 4, 0x0F00 } };
+inline constexpr Decoder::Layout ____nnnniiiiiiii{ { 8, 0x00FF }, { 4, 0x0F00 } };
+inline constexpr Decoder::Layout ________dddddddd{ { 8, 0x00FF } };
+inline constexpr Decoder::Layout ____nnnndddddddd{ { 8, 0x00FF }, { 4, 0xF00 } };
+inline constexpr Decoder::Layout ____nnnn________{ { 4, 0x0F00 } };
+inline constexpr Decoder::Layout ____nnnnmmmmdddd{ { 4, 0x000F }, { 4, 0x00F0 }, { 4, 0x0F00 } };
+inline constexpr Decoder::Layout ________mmmmdddd{ { 4, 0x000F }, { 4, 0x00F0 } };
+inline constexpr Decoder::Layout ____dddddddddddd{ { 12, 0x0FFF } };
+inline constexpr Decoder::Layout ____mmmm_nnn____{ { 3, 0x0070 }, { 4, 0x0F00 } };
+inline constexpr Decoder::Layout ____nnn_mmm_____{ { 3, 0x00E0 }, { 3, 0x0E00 } };
+inline constexpr Decoder::Layout ____nnn_mmmm____{ { 4, 0x00F0 }, { 3, 0x0E00 } };
+inline constexpr Decoder::Layout ____nnnnmmm_____{ { 3, 0x00E0 }, { 4, 0x0F00 } };
+inline constexpr Decoder::Layout ____nnmm________{ { 2, 0x0300 }, { 2, 0x0C00 } };
+inline constexpr Decoder::Layout ____nn__________{ { 2, 0x0C00 } };
+inline constexpr Decoder::Layout ____mmm_________{ { 3, 0x0E00 } };
+inline constexpr Decoder::Layout ____nnn_________{ { 3, 0x0E00 } };
+inline constexpr Decoder::Layout ________________{};
+
+inline constexpr Decoder::Layout ________nnnndddd = ________mmmmdddd;
+inline constexpr Decoder::Layout ____mmmm________ = ____nnnn________;
+inline constexpr Decoder::Layout ________iiiiiiii = ________dddddddd;
+inline constexpr Decoder::Layout ____nnnn_mmm____ = ____mmmm_nnn____;
+
+inline constexpr Decoder::Inst Decoder::instructions[]
+{
+	// http://www.shared-ptr.com/sh_insns.html
+	#include "inst.inl"
+
+	// the unknown entry lives at the end so every dispatch slot is a valid index
+	{ "????", 0, 0, {}, Group::None, 0, 0, false }
+};
+
+inline constexpr size_t Decoder::instructionCount = std::size(Decoder::instructions);
+
+constexpr auto buildDispatchTable()
+{
+	constexpr auto unknownIndex = uint16_t(Decoder::instructionCount - 1);
+	std::array<uint16_t, 0x10000 + 1> table{};
+
+	for (auto& entry : table)
+		entry = unknownIndex;
+
+	// walk backwards so earlier entries in inst.inl overwrite later ones,
+	// which keeps the first-match priority
+	for (int i = int(unknownIndex) - 1; i >= 0; i--)
+	{
+		const auto& op = Decoder::instructions[i];
+		const uint16_t fixedBits = op.op & op.decodingMask;
+		const uint16_t freeBits = uint16_t(~op.decodingMask);
+
+		// enumerate every combination of the operand bits
+		uint16_t operandBits = freeBits;
+		while (true)
+		{
+			table[fixedBits | operandBits] = uint16_t(i);
+
+			if (operandBits == 0)
+				break;
+
+			operandBits = (operandBits - 1) & freeBits;
+		}
+	}
+
+	return table;
+}
+
+inline constexpr std::array<uint16_t, 0x10000 + 1> Decoder::dispatch = buildDispatchTable();
+
+static_assert(Decoder::instructionCount <= 256, "DecodedInst::id is only 8 bits");
+
+constexpr DecodedInst Decoder::pack(uint16_t opId, uint16_t inst)
+{
+	const auto& layout = instructions[opId].layout;
+	uint32_t fields[4]{};
+
+	for (int i = 0; i < layout.count; i++)
+		fields[i] = (inst & layout.dataOffsets[i].mask) >> layout.dataOffsets[i].shift;
+
+	return { opId, fields[0], fields[1], fields[2], fields[3] };
+}
+
+constexpr bool layoutsFitDecodedInst()
+{
+	for (const auto& inst : Decoder::instructions)
+		for (int i = 0; i < inst.layout.count; i++)
+			if (inst.layout.dataOffsets[i].size > (i == 0 ? 12 : 4))
+				return false;
+
+	return true;
+}
+
+static_assert(layoutsFitDecodedInst(), "an operand field is too wide for DecodedInst");
+
+constexpr auto buildDecodedTable()
+{
+	std::array<DecodedInst, 0x10000> table{};
+
+	for (size_t i = 0; i < table.size(); i++)
+		table[i] = Decoder::pack(Decoder::dispatch[i], uint16_t(i));
+
+	return table;
+}
+
+inline constexpr std::array<DecodedInst, 0x10000> Decoder::decodedTable = buildDecodedTable();
+
+inline int Decoder::format(DecodedInst inst, char* dstString, size_t dstSize)
+{
+	return snprintf(dstString, dstSize,
+		instructions[inst.id].decodeString,
+		unsigned(inst.field0), unsigned(inst.field1), unsigned(inst.field2), unsigned(inst.field3)
+	);
+}
+
+inline void decodeBatchScalar(const uint16_t* in, size_t n, uint16_t* opIds, bool swapBytes)
+{
+	const auto* table = Decoder::dispatch.data();
+
+	if (swapBytes)
+	{
+		for (size_t i = 0; i < n; i++)
+			opIds[i] = table[uint16_t((in[i] >> 8) | (in[i] << 8))];
+	}
+	else
+	{
+		for (size_t i = 0; i < n; i++)
+			opIds[i] = table[in[i]];
+	}
+}
+
+#if DECOMPSH_X86
+DECOMPSH_TARGET("avx2") static void decodeBatchAvx2(const uint16_t* in, size_t n, uint16_t* opIds, bool swapBytes)
+{
+	const __m256i swapMask = _mm256_setr_epi8(
+		1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+		1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14
+	);
+	const __m256i lowHalf = _mm256_set1_epi32(0xFFFF);
+	const auto* table = reinterpret_cast<const int*>(Decoder::dispatch.data());
+
+	size_t i = 0;
+
+	for (; i + 16 <= n; i += 16)
+	{
+		__m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+
+		if (swapBytes)
+			words = _mm256_shuffle_epi8(words, swapMask);
+
+		const __m256i lo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(words));
+		const __m256i hi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(words, 1));
+
+		// 32 bit gathers at a 2 byte stride, the top half is the neighbouring slot
+		const __m256i idsLo = _mm256_and_si256(_mm256_i32gather_epi32(table, lo, 2), lowHalf);
+		const __m256i idsHi = _mm256_and_si256(_mm256_i32gather_epi32(table, hi, 2), lowHalf);
+
+		// packus interleaves the two 128 bit lanes, the permute puts them back in order
+		const __m256i ids = _mm256_permute4x64_epi64(_mm256_packus_epi32(idsLo, idsHi), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(opIds + i), ids);
+	}
+
+	decodeBatchScalar(in + i, n - i, opIds + i, swapBytes);
+}
+#endif
+
+using DecodeBatchKernel = void (*)(const uint16_t*, size_t, uint16_t*, bool);
+
+inline DecodeBatchKernel selectDecodeBatchKernel()
+{
+#if DECOMPSH_X86
+	if (getCpuFeatures().avx2)
+		return decodeBatchAvx2;
+#endif
+
+	return decodeBatchScalar;
+}
+
+inline void Decoder::decodeBatch(const uint16_t* in, size_t n, uint16_t* opIds, bool swapBytes)
+{
+	static const auto kernel = selectDecodeBatchKernel();
+
+	kernel(in, n, opIds, swapBytes);
+}
+
+inline void Decoder::decode(std::span<const uint16_t> words, std::span<DecodedInst> out, bool swapBytes)
+{
+	const size_t count = std::min(words.size(), out.size());
+	const auto* table = decodedTable.data();
+
+	if (swapBytes)
+	{
+		for (size_t i = 0; i < count; i++)
+			out[i] = table[uint16_t((words[i] >> 8) | (words[i] << 8))];
+	}
+	else
+	{
+		for (size_t i = 0; i < count; i++)
+			out[i] = table[words[i]];
+	}
+}
+
+// how an instruction affects control flow, used when tracing from entry points
+enum class Flow : uint8_t
+{
+	None,
+	Branch,				// bra
+	Call,				// bsr
+	CondBranch,			// bt, bf
+	CondBranchDelayed,	// bt/s, bf/s
+	Jump,				// jmp, braf
+	CallIndirect,		// jsr, bsrf
+	Return,				// rts, rte
+	Invalid,			// anything that didn't decode
+};
+
+constexpr bool mnemonicIs(const char* decodeString, const char* mnemonic)
+{
+	int i = 0;
+
+	for (; mnemonic[i]; i++)
+		if (decodeString[i] != mnemonic[i])
+			return false;
+
+	return decodeString[i] == ' ' || decodeString[i] == '\0';
+}
+
+constexpr auto buildFlowTable()
+{
+	std::array<Flow, Decoder::instructionCount> flows{};
+
+	for (size_t i = 0; i < flows.size(); i++)
+	{
+		const auto& op = Decoder::instructions[i];
+		auto& flow = flows[i];
+
+		if (!op.valid)
+			flow = Flow::Invalid;
+		else if (mnemonicIs(op.decodeString, "bra"))
+			flow = Flow::Branch;
+		else if (mnemonicIs(op.decodeString, "bsr"))
+			flow = Flow::Call;
+		else if (mnemonicIs(op.decodeString, "bt") || mnemonicIs(op.decodeString, "bf"))
+			flow = Flow::CondBranch;
+		else if (mnemonicIs(op.decodeString, "bt/s") || mnemonicIs(op.decodeString, "bf/s"))
+			flow = Flow::CondBranchDelayed;
+		else if (mnemonicIs(op.decodeString, "jmp") || mnemonicIs(op.decodeString, "braf"))
+			flow = Flow::Jump;
+		else if (mnemonicIs(op.decodeString, "jsr") || mnemonicIs(op.decodeString, "bsrf"))
+			flow = Flow::CallIndirect;
+		else if (mnemonicIs(op.decodeString, "rts") || mnemonicIs(op.decodeString, "rte"))
+			flow = Flow::Return;
+	}
+
+	return flows;
+}
+
+// indexed the same as Decoder::instructions
+inline constexpr auto instructionFlows = buildFlowTable();
+
+constexpr bool hasDelaySlot(Flow flow)
+{
+	return flow == Flow::Branch || flow == Flow::Call || flow == Flow::CondBranchDelayed ||
+		flow == Flow::Jump || flow == Flow::CallIndirect || flow == Flow::Return;
+}
+
+// pc relative targets, the displacement is in halfwords from the branch + 4
+inline uint64_t getBranchTarget(Flow flow, uint16_t op, uint64_t position)
+{
+	int64_t disp{};
+
+	if (flow == Flow::Branch || flow == Flow::Call)
+		disp = int16_t(op << 4) >> 4;
+	else
+		disp = int8_t(op & 0xFF);
+
+	return position + 4 + disp * 2;
+}
+
+// pc relative loads that read a constant out of a literal pool
+enum class Literal : uint8_t
+{
+	None,
+	Word,		// mov.w @(disp,PC),Rn
+	Long,		// mov.l @(disp,PC),Rn
+	Address,	// mova @(disp,PC),R0 only computes the address
+};
+
+constexpr auto buildLiteralTable()
+{
+	std::array<Literal, Decoder::instructionCount> literals{};
+
+	for (size_t i = 0; i < literals.size(); i++)
+	{
+		const auto& op = Decoder::instructions[i];
+
+		if (op.valid && op.decodingMask == 0xF000 && op.op == 0x9000)
+			literals[i] = Literal::Word;
+		else if (op.valid && op.decodingMask == 0xF000 && op.op == 0xD000)
+			literals[i] = Literal::Long;
+		else if (op.valid && op.decodingMask == 0xFF00 && op.op == 0xC700)
+			literals[i] = Literal::Address;
+	}
+
+	return literals;
+}
+
+// indexed the same as Decoder::instructions
+inline constexpr auto instructionLiterals = buildLiteralTable();
+
+// words are PC + 4 + disp * 2, longs (and mova) use (PC & ~3) + 4 + disp * 4
+inline uint64_t getLiteralAddress(Literal literal, uint16_t op, uint64_t address)
+{
+	const uint64_t disp = op & 0xFF;
+
+	if (literal == Literal::Word)
+		return address + 4 + disp * 2;
+
+	return (address & ~3ull) + 4 + disp * 4;
+}
+
+// changes whenever inst.inl does, so a cache from another decoder is never trusted
+constexpr uint64_t computeDecoderVersion()
+{
+	uint64_t hash = 0xCBF29CE484222325ull;
+	auto mix = [&](uint64_t value) { hash = (hash ^ value) * 0x100000001B3ull; };
+
+	for (const auto& op : Decoder::instructions)
+	{
+		mix(op.op);
+		mix(op.decodingMask);
+
+		for (auto* c = op.decodeString; *c; c++)
+			mix(uint8_t(*c));
+
+		for (int i = 0; i < op.layout.count; i++)
+			mix(op.layout.dataOffsets[i].mask);
+	}
+
+	return hash;
+}
+
+inline constexpr uint64_t decoderVersion = computeDecoderVersion();
@@ -0,0 +1,25 @@
+#include "decompsh.h"
+#include "decoder.h"
+
+namespace decompsh
+{
+	void decode(std::span<const uint16_t> words, std::span<DecodedInst> out, bool swapBytes)
+	{
+		Decoder::decode(words, out, swapBytes);
+	}
+
+	DecodedInst decode(uint16_t word)
+	{
+		return Decoder::decodedTable[word];
+	}
+
+	bool isValid(DecodedInst inst)
+	{
+		return Decoder::instructions[inst.id].valid;
+	}
+
+	int format(DecodedInst inst, char* buffer, size_t size)
+	{
+		return Decoder::format(inst, buffer, size);
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <bit>
+
+// the decoder on its own, for embedding in emulators, debuggers and patching
+// tools. nothing in here touches files, allocates or keeps any state between
+// calls, so all of it can be called from any number of threads at once.
+// link against libdecompsh, the tables are built at compile time
+namespace decompsh
+{
+	// a decoded word: the index into the instruction table plus the operand
+	// fields already pulled out of it in printf order. no layout has more than
+	// 12 bits in its first field or 4 in the others, so it all packs into 32
+	// bits and a whole image can be decoded up front then walked without
+	// touching any strings
+	struct DecodedInst
+	{
+		uint32_t id : 8;
+		uint32_t field0 : 12;
+		uint32_t field1 : 4;
+		uint32_t field2 : 4;
+		uint32_t field3 : 4;
+	};
+
+	static_assert(sizeof(DecodedInst) == 4);
+
+	// decodes min(words.size(), out.size()) words. 'swapBytes' is for big
+	// endian hosts or images that were dumped with the halfwords swapped
+	void decode(std::span<const uint16_t> words, std::span<DecodedInst> out, bool swapBytes = std::endian::native == std::endian::big);
+
+	DecodedInst decode(uint16_t word);
+
+	// false for words that aren't an SH4 instruction
+	bool isValid(DecodedInst inst);
+
+	// writes the text for 'inst' (without the address or opcode bytes) and
+	// returns its length like snprintf does, truncating if 'size' is too small
+	int format(DecodedInst inst, char* buffer, size_t size);
+}
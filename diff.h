@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <span>
+#include <utility>
+#include <algorithm>
+
+// finds where two images differ without decoding either of them. equal runs
+// are skipped with memcmp, and when the images stop lining up the new one is
+// scanned with a rolling hash for the next block that's also in the old one
+// (at or after the same point), so inserted or removed code only costs as much
+// as it is long. everything is in words, instructions can't start in between
+
+struct DiffChange
+{
+	size_t oldStart{};	// word indices, [start, end) of each image
+	size_t oldEnd{};
+	size_t newStart{};
+	size_t newEnd{};
+};
+
+inline constexpr size_t diffBlockWords = 16;
+inline constexpr uint32_t diffHashFactor = 0x01000193;
+
+inline uint32_t hashDiffBlock(const uint16_t* words)
+{
+	uint32_t hash{};
+
+	for (size_t i = 0; i < diffBlockWords; i++)
+		hash = hash * diffHashFactor + words[i];
+
+	return hash;
+}
+
+inline std::vector<DiffChange> diffWords(std::span<const uint16_t> a, std::span<const uint16_t> b)
+{
+	constexpr size_t k = diffBlockWords;
+
+	// diffHashFactor ^ (k - 1), what the word leaving the window was multiplied by
+	uint32_t outFactor = 1;
+	for (size_t i = 1; i < k; i++)
+		outFactor *= diffHashFactor;
+
+	std::vector<DiffChange> changes;
+	std::vector<std::pair<uint32_t, uint32_t>> blocks;	// (hash, index) of every aligned block of 'a', made on the first change
+	size_t i{};
+	size_t j{};
+
+	while (true)
+	{
+		while (i + k <= a.size() && j + k <= b.size() && !memcmp(&a[i], &b[j], k * 2))
+		{
+			i += k;
+			j += k;
+		}
+
+		while (i < a.size() && j < b.size() && a[i] == b[j])
+		{
+			i++;
+			j++;
+		}
+
+		if (i == a.size() && j == b.size())
+			break;
+
+		if (blocks.empty())
+		{
+			for (size_t p = 0; p + k <= a.size(); p += k)
+				blocks.push_back({ hashDiffBlock(&a[p]), uint32_t(p) });
+
+			std::sort(blocks.begin(), blocks.end());
+		}
+
+		// the first block of 'b' that's also in 'a' ahead of where they split
+		size_t syncA = a.size();
+		size_t syncB = b.size();
+
+		if (j + k <= b.size() && i < a.size())
+		{
+			uint32_t hash = hashDiffBlock(&b[j]);
+
+			for (size_t t = j; syncB == b.size(); t++)
+			{
+				auto it = std::lower_bound(blocks.begin(), blocks.end(), std::pair{ hash, uint32_t(i) });
+
+				for (; it != blocks.end() && it->first == hash; it++)
+				{
+					if (!memcmp(&a[it->second], &b[t], k * 2))
+					{
+						syncA = it->second;
+						syncB = t;
+						break;
+					}
+				}
+
+				if (t + k >= b.size())
+					break;
+
+				hash = (hash - b[t] * outFactor) * diffHashFactor + b[t + k];
+			}
+		}
+
+		// blocks in 'a' are aligned so the match can start a little earlier
+		while (syncA > i && syncB > j && a[syncA - 1] == b[syncB - 1])
+		{
+			syncA--;
+			syncB--;
+		}
+
+		changes.push_back({ i, syncA, j, syncB });
+
+		i = syncA;
+		j = syncB;
+	}
+
+	return changes;
+}
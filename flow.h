@@ -0,0 +1,428 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <stack>
+#include <vector>
+#include <string>
+#include <span>
+#include <algorithm>
+
+#include "image.h"
+#include "decoder.h"
+#include "loader.h"
+
+// which words of an image are reachable code, cut up into basic blocks, and
+// the --cache file that keeps that between runs
+
+struct State
+{
+	uint64_t position{};
+};
+
+struct Block
+{
+	uint64_t start{};
+	uint64_t end{};		// one past the last word, delay slot included
+	uint64_t successors[2]{};
+	int successorCount{};
+};
+
+struct FlowGraph
+{
+	std::vector<bool> visited;		// one bit per word of the view
+	std::vector<Block> blocks;		// sorted by start
+	std::vector<uint64_t> functions;	// entry points and call targets, sorted
+};
+
+// recursive descent from a set of entry points, only code that is actually
+// reachable gets decoded so literal pools and tables in between are skipped.
+// indirect jumps (jmp/jsr/braf/bsrf) can't be followed statically
+struct FlowTracer
+{
+	bool followCalls = true;	// off to trace just one function
+
+	FlowTracer(const ImageView& view, std::span<const uint16_t> opIds) :
+		view(view), opIds(opIds)
+	{
+		graph.visited.assign(view.words.size(), false);
+		leaders.assign(view.words.size() + 1, false);
+		blockEnds.assign(view.words.size() + 1, false);
+	}
+
+	void addFunction(uint64_t position)
+	{
+		if (view.contains(position))
+			graph.functions.push_back(position);
+	}
+
+	void trace(uint64_t entry)
+	{
+		if (!addLeader(entry))
+			return;
+
+		worklist.push({ entry });
+
+		while (!worklist.empty())
+		{
+			State state = worklist.top();
+			worklist.pop();
+
+			walk(state);
+		}
+	}
+
+	FlowGraph finish()
+	{
+		std::sort(graph.functions.begin(), graph.functions.end());
+		graph.functions.erase(std::unique(graph.functions.begin(), graph.functions.end()), graph.functions.end());
+
+		buildBlocks();
+
+		return std::move(graph);
+	}
+
+private:
+	const ImageView& view;
+	std::span<const uint16_t> opIds;
+	FlowGraph graph;
+	std::vector<bool> leaders;
+	std::vector<bool> blockEnds;
+	std::stack<State> worklist;
+
+	size_t indexOf(uint64_t position) const
+	{
+		return size_t((position - view.offset) / 2);
+	}
+
+	Flow getFlow(uint64_t position) const
+	{
+		return instructionFlows[opIds[indexOf(position)]];
+	}
+
+	bool addLeader(uint64_t position)
+	{
+		if (!view.contains(position))
+			return false;
+
+		leaders[indexOf(position)] = true;
+		return true;
+	}
+
+	void walk(State state)
+	{
+		while (view.contains(state.position) && !graph.visited[indexOf(state.position)])
+		{
+			const auto index = indexOf(state.position);
+			const auto flow = getFlow(state.position);
+
+			graph.visited[index] = true;
+
+			if (flow == Flow::None)
+			{
+				state.position += 2;
+				continue;
+			}
+
+			if (flow == Flow::Invalid)
+			{
+				blockEnds[index + 1] = true;
+				break;
+			}
+
+			uint64_t next = state.position + 2;
+
+			if (hasDelaySlot(flow) && view.contains(next))
+			{
+				graph.visited[indexOf(next)] = true;
+				next += 2;
+			}
+
+			blockEnds[indexOf(next)] = true;
+
+			if (flow == Flow::Branch || flow == Flow::Call || flow == Flow::CondBranch || flow == Flow::CondBranchDelayed)
+			{
+				const auto target = getBranchTarget(flow, view.getWord(state.position), state.position);
+
+				if (addLeader(target))
+				{
+					if (flow != Flow::Call || followCalls)
+						worklist.push({ target });
+
+					if (flow == Flow::Call)
+						graph.functions.push_back(target);
+				}
+			}
+
+			// calls come back and conditional branches may fall through
+			if (flow == Flow::Call || flow == Flow::CallIndirect || flow == Flow::CondBranch || flow == Flow::CondBranchDelayed)
+			{
+				addLeader(next);
+				state.position = next;
+				continue;
+			}
+
+			break;
+		}
+	}
+
+	// cuts the visited words up into basic blocks
+	void buildBlocks()
+	{
+		const auto wordCount = view.words.size();
+		graph.blocks.clear();
+
+		for (size_t i = 0; i < wordCount; i++)
+		{
+			if (!graph.visited[i])
+				continue;
+
+			Block block{ view.offset + i * 2 };
+
+			do
+			{
+				i++;
+			}
+			while (i < wordCount && graph.visited[i] && !leaders[i] && !blockEnds[i]);
+
+			block.end = view.offset + i * 2;
+
+			// the terminator is either the last word or the one before its delay slot
+			uint64_t terminator = block.end - 2;
+			auto flow = getFlow(terminator);
+
+			if (block.end - block.start >= 4 && hasDelaySlot(getFlow(block.end - 4)))
+			{
+				terminator = block.end - 4;
+				flow = getFlow(terminator);
+			}
+
+			auto addSuccessor = [&](uint64_t position)
+			{
+				if (view.contains(position) && graph.visited[indexOf(position)])
+					block.successors[block.successorCount++] = position;
+			};
+
+			switch (flow)
+			{
+			case Flow::Branch:
+				addSuccessor(getBranchTarget(flow, view.getWord(terminator), terminator));
+				break;
+
+			case Flow::CondBranch:
+			case Flow::CondBranchDelayed:
+				addSuccessor(getBranchTarget(flow, view.getWord(terminator), terminator));
+				addSuccessor(block.end);
+				break;
+
+			case Flow::Jump:
+			case Flow::Return:
+			case Flow::Invalid:
+				break;
+
+			default:
+				addSuccessor(block.end);
+				break;
+			}
+
+			graph.blocks.push_back(block);
+			i--;
+		}
+	}
+};
+
+inline std::vector<uint16_t> decodeView(const ImageView& view)
+{
+	std::vector<uint16_t> opIds(view.words.size());
+	Decoder::decodeBatch(view.words.data(), view.words.size(), opIds.data());
+
+	return opIds;
+}
+
+inline FlowGraph traceFlow(const ImageView& view, std::span<const uint16_t> opIds, const std::vector<uint64_t>& entries)
+{
+	FlowTracer tracer(view, opIds);
+
+	for (auto entry : entries)
+	{
+		tracer.addFunction(entry);
+		tracer.trace(entry);
+	}
+
+	return tracer.finish();
+}
+
+// analysis results kept on disk between runs, keyed on the image contents, the
+// entry points and the decoder version. only the graph is kept, decoding the
+// image again is quicker than reading the decoded words back from disk
+struct AnalysisCache
+{
+	struct Header
+	{
+		char magic[4]{ 'D', 'S', 'H', 'C' };
+		uint32_t formatVersion{ 2 };
+		uint64_t decoderVersion{};
+		uint64_t imageHash{};
+		uint64_t offset{};
+		uint64_t wordCount{};
+		uint32_t base{};
+		uint32_t entryCount{};
+		uint64_t blockCount{};
+		uint64_t functionCount{};
+	};
+
+	Header header;
+	std::vector<uint64_t> entries;
+	std::vector<Block> blocks;
+	std::vector<uint64_t> functions;
+
+	AnalysisCache() = default;
+
+	AnalysisCache(const ImageView& view, const std::vector<uint64_t>& entries) :
+		entries(entries)
+	{
+		header.decoderVersion = decoderVersion;
+		header.imageHash = hashBytes(view.words.data(), view.words.size() * 2);
+		header.offset = view.offset;
+		header.wordCount = view.words.size();
+		header.base = view.base;
+		header.entryCount = uint32_t(entries.size());
+	}
+
+	// same decoder, the same window of the same image and the same entries
+	bool isSameAnalysis(const AnalysisCache& other) const
+	{
+		return header.decoderVersion == other.header.decoderVersion &&
+			header.imageHash == other.header.imageHash &&
+			header.offset == other.header.offset &&
+			header.wordCount == other.header.wordCount &&
+			header.base == other.header.base &&
+			entries == other.entries;
+	}
+
+	// a file that doesn't fit 'view' is rejected before anything is allocated
+	// from its counts, the same as a bad binary listing
+	bool load(const std::string& path, const ImageView& view)
+	{
+		auto* file = fopen(path.c_str(), "rb");
+
+		if (!file)
+			return false;
+
+		const Header expected{};
+		uint64_t fileSize{};
+		bool ok =
+			getFileSize(file, fileSize) &&
+			seekFile(file, 0) &&
+			fread(&header, sizeof(header), 1, file) == 1 &&
+			!memcmp(header.magic, expected.magic, sizeof(header.magic)) &&
+			header.formatVersion == expected.formatVersion &&
+			header.offset == view.offset &&
+			header.wordCount == view.words.size();
+
+		uint64_t left = ok ? fileSize - sizeof(header) : 0;
+
+		auto readArray = [&](auto& array, uint64_t count)
+		{
+			if (count > left / sizeof(array[0]))
+				return false;
+
+			left -= count * sizeof(array[0]);
+			array.resize(size_t(count));
+			return fread(array.data(), sizeof(array[0]), array.size(), file) == array.size();
+		};
+
+		ok = ok &&
+			readArray(entries, header.entryCount) &&
+			readArray(blocks, header.blockCount) &&
+			readArray(functions, header.functionCount) &&
+			left == 0;
+
+		fclose(file);
+
+		if (!ok)
+			return false;
+
+		const auto end = view.offset + view.words.size() * 2;
+		auto isWord = [&](uint64_t position) { return view.contains(position) && (position - view.offset) % 2 == 0; };
+
+		// blocks are in order, inside the view and have at most two successors
+		for (size_t i = 0; i < blocks.size(); i++)
+		{
+			const auto& block = blocks[i];
+
+			if (!isWord(block.start) || block.end <= block.start || block.end > end || (block.end - block.start) % 2 ||
+				(i && block.start < blocks[i - 1].end) || block.successorCount < 0 || block.successorCount > 2)
+				return false;
+
+			for (int s = 0; s < block.successorCount; s++)
+				if (!isWord(block.successors[s]))
+					return false;
+		}
+
+		return std::all_of(functions.begin(), functions.end(), isWord);
+	}
+
+	bool save(const std::string& path)
+	{
+		auto* file = fopen(path.c_str(), "wb");
+
+		if (!file)
+			return false;
+
+		header.blockCount = blocks.size();
+		header.functionCount = functions.size();
+
+		auto writeArray = [&](const auto& array)
+		{
+			return fwrite(array.data(), sizeof(array[0]), array.size(), file) == array.size();
+		};
+
+		const bool ok =
+			fwrite(&header, sizeof(header), 1, file) == 1 &&
+			writeArray(entries) &&
+			writeArray(blocks) &&
+			writeArray(functions);
+
+		fclose(file);
+
+		return ok;
+	}
+};
+
+// traces the image like traceFlow() but goes through the cache file at 'path'.
+// the same image and entries give back the stored graph, anything else is a
+// full trace. a patch can make code reachable or unreachable anywhere so the
+// old graph can't be patched up, all a changed image costs on top of a run
+// without the cache is hashing it and writing the graph out
+inline FlowGraph traceFlowCached(const ImageView& view, const std::vector<uint64_t>& entries, const std::string& path)
+{
+	AnalysisCache current(view, entries);
+	AnalysisCache previous;
+
+	if (previous.load(path, view) && current.isSameAnalysis(previous))
+	{
+		FlowGraph graph;
+		graph.visited.assign(view.words.size(), false);
+
+		for (const auto& block : previous.blocks)
+			for (auto position = block.start; position < block.end; position += 2)
+				graph.visited[(position - view.offset) / 2] = true;
+
+		graph.blocks = std::move(previous.blocks);
+		graph.functions = std::move(previous.functions);
+
+		return graph;
+	}
+
+	auto graph = traceFlow(view, decodeView(view), entries);
+
+	current.blocks = graph.blocks;
+	current.functions = graph.functions;
+
+	if (!current.save(path))
+		fprintf(stderr, "couldn't write the analysis cache '%s'\n", path.c_str());
+
+	return graph;
+}
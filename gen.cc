@@ -0,0 +1,653 @@
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <algorithm>
+
+// builds inst.inl out of the instruction tables in source.html
+// (a saved copy of http://www.shared-ptr.com/sh_insns.html), and code.inl out
+// of the reference C code for each instruction. this runs as part of the build
+// whenever source.html changes, the disassembler never parses it
+
+static std::string readTextFile(const std::string& path)
+{
+	std::string string;
+
+	if (auto* file = fopen(path.c_str(), "rb"))
+	{
+		fseek(file, 0, SEEK_END);
+		const long fileSize = ftell(file);
+		fseek(file, 0, SEEK_SET);
+
+		if (fileSize > 0)
+		{
+			string.resize(size_t(fileSize));
+			string.resize(fread(string.data(), 1, string.size(), file));
+		}
+
+		fclose(file);
+	}
+
+	return string;
+}
+
+static bool writeTextToFile(const std::string& path, const std::string& text)
+{
+	// binary so the line endings are exactly what we emit on every platform
+	if (auto* file = fopen(path.c_str(), "wb"))
+	{
+		fwrite(text.data(), 1, text.size(), file);
+		fclose(file);
+
+		return true;
+	}
+
+	return false;
+}
+
+struct Op
+{
+	std::string_view chips;
+	std::string_view name;
+	std::string_view bits;
+	std::string_view code;
+	std::string_view example;
+	std::string_view group;
+	std::string_view issue;
+	std::string_view latency;
+};
+
+// walks the html once front to back. every instruction starts with a
+// col_cont_1 div, the cells after it up to the next one belong to it. all the
+// strings handed out point straight into 'source'
+static std::vector<Op> parseOps(std::string_view source)
+{
+	std::vector<Op> ops;
+	ops.reserve(512);
+
+	size_t position{};
+
+	while ((position = source.find('<', position)) != std::string_view::npos)
+	{
+		const auto tag = source.substr(position);
+		std::string_view* field{};
+		std::string_view terminator;
+
+		auto match = [&](std::string_view opening, std::string_view closing)
+		{
+			if (tag.substr(0, opening.size()) != opening)
+				return false;
+
+			position += opening.size();
+			terminator = closing;
+			return true;
+		};
+
+		if (match("<div class=\"col_cont_1\">", "</div>"))
+		{
+			ops.emplace_back();
+			field = &ops.back().chips;
+		}
+		else if (ops.empty())
+		{
+			position++;
+			continue;
+		}
+		else if (match("<div class=\"col_cont_2\">", "</div>"))
+		{
+			field = &ops.back().name;
+		}
+		else if (match("<div class=\"col_cont_4\">", "</div>"))
+		{
+			field = &ops.back().bits;
+		}
+		else if (match("<div class=\"col_cont_6\">", "</div>"))
+		{
+			field = &ops.back().group;
+		}
+		else if (match("<div class=\"col_cont_7\">", "</div>"))
+		{
+			field = &ops.back().issue;
+		}
+		else if (match("<div class=\"col_cont_8\">", "</div>"))
+		{
+			field = &ops.back().latency;
+		}
+		else if (match("<p class=\"precode\">", "</p>"))
+		{
+			// the operation comes first, any after it are usage examples
+			field = ops.back().code.empty() ? &ops.back().code : &ops.back().example;
+		}
+		else
+		{
+			position++;
+			continue;
+		}
+
+		const auto end = source.find(terminator, position);
+
+		if (end == std::string_view::npos)
+			break;
+
+		*field = source.substr(position, end - position);
+		position = end + terminator.size();
+	}
+
+	return ops;
+}
+
+// single pass replace, at each position the first pattern that matches wins
+static void appendReplaced(std::string& out, std::string_view in, std::initializer_list<std::pair<std::string_view, std::string_view>> replacements)
+{
+	for (size_t i = 0; i < in.size();)
+	{
+		bool replaced = false;
+
+		for (const auto& [pattern, replacement] : replacements)
+		{
+			if (in.substr(i, pattern.size()) == pattern)
+			{
+				out += replacement;
+				i += pattern.size();
+				replaced = true;
+				break;
+			}
+		}
+
+		if (!replaced)
+			out += in[i++];
+	}
+}
+
+// the chip columns are a grid of 6 character cells, three rows of three:
+//   SH1   SH2   SH2E
+//   SH3   SH3E  SH4
+//   SH4   SH4A  SH2A
+// the timing columns use the same grid so the SH4 value sits in the third row
+static std::string_view getCell(std::string_view grid, size_t column)
+{
+	for (int row = 0; row < 2; row++)
+	{
+		const auto newline = grid.find('\n');
+		grid = newline == std::string_view::npos ? std::string_view{} : grid.substr(newline + 1);
+	}
+
+	auto cell = grid.substr(std::min(grid.size(), column * 6), 6);
+	cell = cell.substr(0, cell.find('\n'));
+
+	while (!cell.empty() && cell.back() == ' ')
+		cell.remove_suffix(1);
+
+	while (!cell.empty() && cell.front() == ' ')
+		cell.remove_prefix(1);
+
+	return cell;
+}
+
+// "1/2" and "3-7" style latencies list several cases, the first is the common one
+static int parseCycles(std::string_view cell)
+{
+	int cycles = 0;
+
+	for (size_t i = 0; i < cell.size() && cell[i] >= '0' && cell[i] <= '9'; i++)
+		cycles = cycles * 10 + (cell[i] - '0');
+
+	return cycles;
+}
+
+static const char* createBitString(uint16_t val)
+{
+	using T = uint16_t;
+	static const auto size = sizeof(T) * 8;
+	static char str[size + 1]{};
+
+	for (size_t i = 0; i < size; i++)
+		str[i] = (val >> (size - i - 1)) & 1 ? '1' : '0';
+
+	return str;
+}
+
+static std::string generateDecoder(const std::vector<Op>& ops)
+{
+	std::string outString;
+	outString.reserve(32 * 1024);
+
+	for (const auto& op : ops)
+	{
+		if (op.chips.find("SH4") == std::string_view::npos || op.bits.size() < 16)
+			continue;
+
+		uint16_t opBits{};
+		uint16_t opMask{};
+		char bitString[16+1]{};
+
+		for (int i = 0; i < 16; i++)
+		{
+			const auto bitIndex = 15 - i;
+
+			switch (op.bits[i])
+			{
+				// 0 and 1 are used to decode the operation type
+			case '0': 
+				opBits |= (0 << bitIndex);
+				opMask |= (1 << bitIndex);
+				bitString[i] = '_';
+				break;
+
+			case '1':
+				opBits |= (1 << bitIndex);
+				opMask |= (1 << bitIndex);
+				bitString[i] = '_';
+				break;
+
+				// n,d,m and i are used as parameters/data
+			case 'n': case 'd': case 'm': case 'i':
+				opBits |= (0 << bitIndex);
+				opMask |= (0 << bitIndex);
+				bitString[i] = op.bits[i];
+				break;
+			}
+		}
+
+		// split the name and args
+		std::string name;
+		appendReplaced(name, op.name, { { "\t", " " } });
+
+		std::string expr;
+		const auto split = name.find(' ');
+
+		if (split != std::string::npos)
+		{
+			appendReplaced(expr, std::string_view(name).substr(split), {
+				{ "Rm", "r[%d]" },
+				{ "Rn", "r[%d]" },
+				{ "#imm", "0x%X" },
+				{ "label", "0x%04X" },
+				{ "disp,PC", "0x%X -> PC" },
+				{ ",", " -> " },
+			});
+
+			name.resize(split);
+		}
+
+		// SH4A only instructions use the SH4A timings
+		const size_t column = getCell(op.chips, 0) == "SH4" ? 0 : 1;
+		auto group = getCell(op.group, column);
+
+		if (group.empty())
+			group = "None";
+
+		char lineBuf[1024]{};
+		sprintf(lineBuf + 0,
+			"{ \"%s                                                       ",
+			name.c_str()
+		);
+
+		sprintf(lineBuf + 16,
+			"%s\",                                                                     ",
+			expr.c_str()
+		);
+
+		sprintf(lineBuf + 51,
+			"BITPACK(%.4s, %.4s, %.4s, %.4s), 0x%02X, %s, Group::%.*s, %d, %d },\r\n", 
+			createBitString(opBits) + 0,
+			createBitString(opBits) + 4,
+			createBitString(opBits) + 8,
+			createBitString(opBits) + 12,
+			opMask,
+			bitString,
+			int(group.size()), group.data(),
+			parseCycles(getCell(op.issue, column)),
+			parseCycles(getCell(op.latency, column))
+		);
+
+		outString += lineBuf;
+	}
+
+	return outString;
+}
+
+static bool isIdentifier(char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+// the reference code is written for several chips at once, this keeps the
+// lines the SH4 takes out of the #if/#elif/#else blocks
+static std::string selectSh4Lines(std::string_view code)
+{
+	std::string out;
+	bool active = true;
+	bool taken = false;
+
+	auto mentionsSh4 = [](std::string_view condition)
+	{
+		for (size_t i = condition.find("SH4"); i != std::string_view::npos; i = condition.find("SH4", i + 1))
+			if ((i == 0 || !isIdentifier(condition[i - 1])) && (i + 3 == condition.size() || !isIdentifier(condition[i + 3]) || condition[i + 3] == 'A'))
+				return true;
+
+		return false;
+	};
+
+	while (!code.empty())
+	{
+		const auto newline = code.find('\n');
+		const auto line = code.substr(0, newline);
+		code = newline == std::string_view::npos ? std::string_view{} : code.substr(newline + 1);
+
+		auto directive = line.substr(std::min(line.size(), line.find_first_not_of(' ')));
+
+		if (directive.substr(0, 3) == "#if")
+		{
+			active = taken = mentionsSh4(directive);
+		}
+		else if (directive.substr(0, 5) == "#elif")
+		{
+			active = !taken && mentionsSh4(directive);
+			taken = taken || active;
+		}
+		else if (directive.substr(0, 5) == "#else")
+		{
+			active = !taken;
+		}
+		else if (directive.substr(0, 6) == "#endif")
+		{
+			active = true;
+		}
+		else if (active)
+		{
+			out += line;
+			out += '\n';
+		}
+	}
+
+	return out;
+}
+
+// everything the reference code may name, the interpreter provides these
+// under the same names (see interpreter.h)
+static constexpr std::string_view interpreterNames[]
+{
+	"R", "PC", "SR", "GBR", "VBR", "SSR", "SPC", "SGR", "DBR", "MACH", "MACL", "PR", "FPSCR", "FPUL", "FR",
+	"Read_8", "Read_16", "Read_32", "Write_8", "Write_16", "Write_32", "Delay_Slot",
+	"invalidate_instruction_cache_block", "invalidate_operand_cache_block", "prefetch_operand_cache_block",
+	"prefetch_instruction_cache_block", "is_dirty_block", "write_back", "is_write_back_memory",
+	"look_up_in_operand_cache", "allocate_operand_cache_block", "MISS", "undefined_operation", "Sleep_standby",
+};
+
+static constexpr std::string_view keywords[]
+{
+	"if", "else", "switch", "case", "default", "break", "return", "for", "while", "do",
+};
+
+// rewrites the body of a reference function for the interpreter. the
+// reference assumes a 32 bit long so the types are made exact, and T, S, Q
+// and M are fields of SR. returns false if it uses anything the interpreter
+// doesn't have (FPU exceptions, the TLB, register banks..)
+static bool translateCode(std::string_view code, std::string_view params, std::string& out, std::string& usedParams)
+{
+	std::vector<std::string_view> locals;
+	bool declaring = false;
+	bool initializer = false;
+	int depth = 0;
+	char previous = '{';
+
+	auto nextWord = [&](size_t position)
+	{
+		while (position < code.size() && code[position] == ' ')
+			position++;
+
+		size_t end = position;
+
+		while (end < code.size() && isIdentifier(code[end]))
+			end++;
+
+		return std::pair{ code.substr(position, end - position), end };
+	};
+
+	for (size_t i = 0; i < code.size();)
+	{
+		const char c = code[i];
+
+		if (code.substr(i, 2) == "//")
+		{
+			const auto end = std::min(code.find('\n', i), code.size());
+			out += code.substr(i, end - i);
+			i = end;
+		}
+		else if (c >= '0' && c <= '9')
+		{
+			for (; i < code.size() && isIdentifier(code[i]); i++)
+				out += code[i];
+
+			previous = '0';
+		}
+		else if (isIdentifier(c))
+		{
+			auto [word, end] = nextWord(i);
+			std::string_view type;
+
+			if (word == "unsigned")
+			{
+				const auto [next, nextEnd] = nextWord(end);
+				type = next == "short" ? "uint16_t" : next == "char" ? "uint8_t" : "uint32_t";
+
+				if (next == "long" || next == "int" || next == "short" || next == "char")
+					end = nextEnd;
+			}
+			else if (word == "long")
+				type = "int32_t";
+			else if (word == "int")
+				type = "int";
+			else if (word == "short")
+				type = "int16_t";
+			else if (word == "char")
+				type = "int8_t";
+
+			if (!type.empty())
+			{
+				// at the start of a statement it declares locals, anywhere else it's a cast
+				if (previous == ';' || previous == '{' || previous == '}')
+				{
+					declaring = true;
+					initializer = false;
+				}
+
+				out += type;
+				previous = 't';
+			}
+			else
+			{
+				const bool declared = declaring && !initializer && depth == 0;
+				const bool param = word.size() == 1 && params.find(word[0]) != std::string_view::npos;
+
+				if (declared)
+					locals.push_back(word);
+
+				if ((word == "T" || word == "S" || word == "Q" || word == "M") && previous != '.' && !declared)
+				{
+					out += "SR.";
+				}
+				else if (!declared && !param &&
+					std::find(std::begin(interpreterNames), std::end(interpreterNames), word) == std::end(interpreterNames) &&
+					std::find(std::begin(keywords), std::end(keywords), word) == std::end(keywords) &&
+					std::find(locals.begin(), locals.end(), word) == locals.end())
+				{
+					return false;
+				}
+
+				if (param && usedParams.find(word[0]) == std::string::npos)
+					usedParams += word[0];
+
+				out += word;
+				previous = 'a';
+			}
+
+			i = end;
+		}
+		else
+		{
+			if (c == '(')
+				depth++;
+			else if (c == ')')
+				depth--;
+			else if (c == '=' && declaring && depth == 0)
+				initializer = true;
+			else if (c == ',' && declaring && depth == 0)
+				initializer = false;
+			else if (c == ';')
+				declaring = false;
+
+			if (c != ' ' && c != '\n')
+				previous = c;
+
+			out += c;
+			i++;
+		}
+	}
+
+	return true;
+}
+
+// one interpreter handler per instruction that has reference code, in the same
+// order as inst.inl so the index is the decoder's op id. the ones that can't be
+// translated are left to Interpreter::execute, which stops the interpreter
+static std::string generateHandlers(const std::vector<Op>& ops)
+{
+	std::string outString;
+	outString.reserve(128 * 1024);
+
+	int index = -1;
+
+	for (const auto& op : ops)
+	{
+		if (op.chips.find("SH4") == std::string_view::npos || op.bits.size() < 16)
+			continue;
+
+		index++;
+
+		const auto open = op.code.find('{');
+		const auto close = op.code.rfind('}');
+
+		if (open == std::string_view::npos || close == std::string_view::npos || close < open)
+			continue;
+
+		// typos in the reference code, and FR holding raw bits rather than a float
+		std::string fixed;
+		appendReplaced(fixed, op.code.substr(open + 1, close - open - 1), {
+			{ "& =", "&=" },
+			{ "(long i)", "(long)i" },
+			{ "Res2 = 0\n", "Res2 = 0;\n" },
+			{ "PC += 2\n", "PC += 2;\n" },
+			{ "write_back (R[n])\n", "write_back (R[n]);\n" },
+			{ "(unsigned short)R[m];", "(unsigned short)R[m]);" },
+			{ "FPSCR_PR", "((FPSCR >> 19) & 1)" },
+			{ "-FR[n]", "FR[n] ^ 0x80000000" },
+			{ "R[0] == imm", "R[0] == (unsigned long)imm" },
+		});
+
+		std::string params;
+
+		for (const char letter : op.bits)
+			if ((letter == 'n' || letter == 'm' || letter == 'd' || letter == 'i') && params.find(letter) == std::string::npos)
+				params += letter;
+
+		std::string body;
+		std::string usedParams;
+
+		if (!translateCode(selectSh4Lines(fixed), params, body, usedParams))
+			continue;
+
+		std::string name;
+		appendReplaced(name, op.name, { { "\t", " " } });
+
+		char lineBuf[256]{};
+		outString += "// " + name + "\r\n";
+		// handlers that don't read any fields leave the word unnamed
+		sprintf(lineBuf, "template <> inline void Interpreter::execute<%d>(uint16_t%s)\r\n{\r\n", index, usedParams.empty() ? "" : " code");
+		outString += lineBuf;
+
+		for (const char letter : params)
+		{
+			if (usedParams.find(letter) == std::string::npos)
+				continue;
+
+			const auto first = op.bits.find(letter);
+			const auto last = op.bits.rfind(letter);
+			const auto shift = 15 - int(last);
+
+			if (shift)
+				sprintf(lineBuf, "\tconst int %c = (code >> %d) & 0x%X;\r\n", letter, shift, (1 << (last - first + 1)) - 1);
+			else
+				sprintf(lineBuf, "\tconst int %c = code & 0x%X;\r\n", letter, (1 << (last - first + 1)) - 1);
+
+			outString += lineBuf;
+		}
+
+		// the reference is indented with two spaces and has blank lines at either end
+		std::string_view lines(body);
+		bool first = true;
+
+		while (!lines.empty())
+		{
+			const auto newline = lines.find('\n');
+			auto line = lines.substr(0, newline);
+			lines = newline == std::string_view::npos ? std::string_view{} : lines.substr(newline + 1);
+
+			while (!line.empty() && (line.back() == ' ' || line.back() == '\r'))
+				line.remove_suffix(1);
+
+			if (line.empty() && (first || lines.find_first_not_of(" \r\n") == std::string_view::npos))
+				continue;
+
+			if (first && !usedParams.empty())
+				outString += "\r\n";
+
+			first = false;
+
+			const auto indent = std::min(line.size(), line.find_first_not_of(' '));
+			outString.append(indent / 2, '\t');
+			outString.append(indent % 2, ' ');
+			outString += line.substr(indent);
+			outString += "\r\n";
+		}
+
+		outString += "}\r\n\r\n";
+	}
+
+	return outString;
+}
+
+int main(int argc, const char** argv)
+{
+	if (argc != 4)
+	{
+		fprintf(stderr, "usage: decompsh_gen source.html inst.inl code.inl\n");
+		return 1;
+	}
+
+	const auto source = readTextFile(argv[1]);
+	const auto ops = parseOps(source);
+
+	if (ops.empty())
+	{
+		fprintf(stderr, "no instructions found in '%s'\n", argv[1]);
+		return 1;
+	}
+
+	if (!writeTextToFile(argv[2], generateDecoder(ops)))
+	{
+		fprintf(stderr, "couldn't write '%s'\n", argv[2]);
+		return 1;
+	}
+
+	if (!writeTextToFile(argv[3], generateHandlers(ops)))
+	{
+		fprintf(stderr, "couldn't write '%s'\n", argv[3]);
+		return 1;
+	}
+
+	return 0;
+}
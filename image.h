@@ -0,0 +1,242 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <span>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// read only view of part of a file on disk. nothing is copied, the pages are
+// only faulted in by the OS once something actually touches them
+struct MappedFile
+{
+	const uint8_t* data{};
+	uint64_t offset{};
+	uint64_t size{};
+
+	MappedFile(const std::string& path, uint64_t start = 0, uint64_t end = UINT64_MAX)
+	{
+#ifdef _WIN32
+		fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (fileHandle == INVALID_HANDLE_VALUE)
+			return;
+
+		LARGE_INTEGER fileSize{};
+		GetFileSizeEx(fileHandle, &fileSize);
+
+		SYSTEM_INFO info{};
+		GetSystemInfo(&info);
+
+		if (!clampRange(uint64_t(fileSize.QuadPart), info.dwAllocationGranularity, start, end))
+			return;
+
+		mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (!mappingHandle)
+			return;
+
+		mapping = MapViewOfFile(mappingHandle, FILE_MAP_READ, DWORD(mappingOffset >> 32), DWORD(mappingOffset), SIZE_T(mappingSize));
+
+		if (!mapping)
+			return;
+#else
+		const int fd = open(path.c_str(), O_RDONLY);
+
+		if (fd < 0)
+			return;
+
+		struct stat info{};
+		fstat(fd, &info);
+
+		if (!clampRange(uint64_t(info.st_size), uint64_t(sysconf(_SC_PAGESIZE)), start, end))
+		{
+			close(fd);
+			return;
+		}
+
+		mapping = mmap(nullptr, size_t(mappingSize), PROT_READ, MAP_PRIVATE, fd, off_t(mappingOffset));
+		close(fd);
+
+		if (mapping == MAP_FAILED)
+		{
+			mapping = nullptr;
+			return;
+		}
+
+		// we almost always sweep front to back
+		madvise(mapping, size_t(mappingSize), MADV_SEQUENTIAL);
+#endif
+
+		data = static_cast<const uint8_t*>(mapping) + (start - mappingOffset);
+		offset = start;
+		size = end - start;
+	}
+
+	~MappedFile()
+	{
+#ifdef _WIN32
+		if (mapping)
+			UnmapViewOfFile(mapping);
+
+		if (mappingHandle)
+			CloseHandle(mappingHandle);
+
+		if (fileHandle != INVALID_HANDLE_VALUE)
+			CloseHandle(fileHandle);
+#else
+		if (mapping)
+			munmap(mapping, size_t(mappingSize));
+#endif
+	}
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool isValid() const
+	{
+		return data != nullptr;
+	}
+
+	// the mapped range as SH4 instruction words (in host byte order)
+	std::span<const uint16_t> getWords() const
+	{
+		return { reinterpret_cast<const uint16_t*>(data), size_t(size / 2) };
+	}
+
+private:
+	void* mapping{};
+	uint64_t mappingOffset{};
+	uint64_t mappingSize{};
+
+#ifdef _WIN32
+	HANDLE fileHandle{ INVALID_HANDLE_VALUE };
+	HANDLE mappingHandle{};
+#endif
+
+	// keeps the range inside the file and halfword aligned, the mapping itself
+	// has to start on a page (or allocation granularity) boundary
+	bool clampRange(uint64_t fileSize, uint64_t granularity, uint64_t& start, uint64_t& end)
+	{
+		end = std::min(end, fileSize);
+		start &= ~1ull;
+		end = start + ((end > start ? end - start : 0) & ~1ull);
+
+		if (start >= end)
+			return false;
+
+		mappingOffset = start - (start % granularity);
+		mappingSize = end - mappingOffset;
+
+		return true;
+	}
+};
+
+// the words being worked on and where they live, both in the file and in the
+// SH4 address space. positions are file offsets like State::position
+struct ImageView
+{
+	std::span<const uint16_t> words;
+	uint64_t offset{};
+	uint32_t base{};
+
+	bool contains(uint64_t position) const
+	{
+		return position >= offset && position - offset < words.size() * 2;
+	}
+
+	uint16_t getWord(uint64_t position) const
+	{
+		return words[(position - offset) / 2];
+	}
+
+	// addresses wrap at 32 bits, 'base' can be "negative" when a section is
+	// loaded below its offset in the file
+	uint64_t getAddress(uint64_t position) const
+	{
+		return uint32_t(base + position);
+	}
+
+	// P1 and P2 mirror the same physical memory, so addresses are compared physically
+	bool getPosition(uint32_t address, uint64_t& position) const
+	{
+		position = (address - base) & 0x1FFFFFFF;
+
+		return contains(position);
+	}
+};
+
+// one bit per word of a view, set for words that are known to be data (like
+// the literal pools that pc relative loads read from) so they aren't decoded
+struct CodeDataMap
+{
+	std::vector<bool> dataWords;
+	std::vector<bool> dataWindows;	// per window of classifyWindowWords (classify.h), whole windows that are listed as one line
+
+	bool isData(size_t index) const
+	{
+		return index < dataWords.size() && dataWords[index];
+	}
+
+	bool isDataWindow(size_t window) const
+	{
+		return window < dataWindows.size() && dataWindows[window];
+	}
+};
+
+// used to tell whether an image changed since something about it was saved.
+// long inputs go through four lanes at once so the multiplies overlap, it
+// runs over whole images on every cached run
+inline uint64_t hashBytes(const void* data, size_t size, uint64_t hash = 0xCBF29CE484222325ull)
+{
+	const auto* bytes = static_cast<const uint8_t*>(data);
+
+	auto mix = [](uint64_t& lane, uint64_t value)
+	{
+		lane = (lane ^ value) * 0x9E3779B97F4A7C15ull;
+		lane ^= lane >> 32;
+	};
+
+	if (size >= 32)
+	{
+		uint64_t lanes[4]{ hash, hash + 1, hash + 2, hash + 3 };
+
+		for (; size >= 32; size -= 32, bytes += 32)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				uint64_t value{};
+				memcpy(&value, bytes + i * 8, 8);
+				mix(lanes[i], value);
+			}
+		}
+
+		for (auto lane : lanes)
+			mix(hash, lane);
+	}
+
+	for (; size >= 8; size -= 8, bytes += 8)
+	{
+		uint64_t value{};
+		memcpy(&value, bytes, 8);
+		mix(hash, value);
+	}
+
+	uint64_t tail{};
+	memcpy(&tail, bytes, size);
+	mix(hash, tail ^ (uint64_t(size) << 56));
+
+	return hash;
+}
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <bit>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "decoder.h"
+
+// runs bits of SH4 code out of an image, for finding out where computed jumps
+// go, letting code decrypt itself or stepping through BIOS init. the handlers
+// are the reference C from source.html (generated into code.inl). it's call
+// threaded, run() calls them one after another out of blocks of predecoded
+// instructions cached by pc rather than each handler jumping to the next.
+// memory is flat ram over the 29 bit physical space, there's no MMU, caches,
+// exceptions, register banks or FPU arithmetic, anything it can't do stops it
+struct Interpreter
+{
+	enum class Stop : uint8_t
+	{
+		None,
+		Steps,			// ran as many instructions as it was allowed to
+		Returned,		// got to the exit address
+		Unsupported,	// an instruction without a handler (FPU maths, traps, the TLB..)
+		SlotIllegal,	// a branch in a delay slot
+		Fetch,			// jumped somewhere without any memory
+		Sleep,
+	};
+
+	// T, S, Q and M are fields so the reference code can use them by name
+	struct StatusRegister
+	{
+		uint32_t T : 1;
+		uint32_t S : 1;
+		uint32_t : 2;
+		uint32_t IMASK : 4;
+		uint32_t Q : 1;
+		uint32_t M : 1;
+		uint32_t : 5;
+		uint32_t FD : 1;
+		uint32_t : 12;
+		uint32_t BL : 1;
+		uint32_t RB : 1;
+		uint32_t MD : 1;
+		uint32_t : 1;
+
+		operator uint32_t() const { return std::bit_cast<uint32_t>(*this); }
+		StatusRegister& operator=(uint32_t value) { return *this = std::bit_cast<StatusRegister>(value); }
+	};
+
+	using Handler = void (*)(Interpreter&, uint16_t);
+
+	struct Predecoded
+	{
+		Handler handler;
+		uint16_t code;
+	};
+
+	// straight line code up to and including a branch, the delay slot is
+	// fetched when the branch runs
+	struct Block
+	{
+		uint32_t start{};
+		Flow flow{};
+		std::vector<Predecoded> insts;
+	};
+
+	static constexpr uint32_t pageBits = 16;
+	static constexpr uint32_t pageSize = 1u << pageBits;
+	static constexpr uint32_t lineBits = 5;	// writes to code are noticed per 32 byte line
+	static constexpr size_t maxBlockLength = 256;
+
+	struct Page
+	{
+		uint8_t bytes[pageSize]{};
+		uint64_t codeLines[(pageSize >> lineBits) / 64]{};
+	};
+
+	// the registers, named like the reference code names them
+	uint32_t R[16]{};
+	uint32_t PC{};
+	StatusRegister SR{};
+	uint32_t GBR{};
+	uint32_t VBR{};
+	uint32_t SSR{};
+	uint32_t SPC{};
+	uint32_t SGR{};
+	uint32_t DBR{};
+	uint32_t MACH{};
+	uint32_t MACL{};
+	uint32_t PR{};
+	uint32_t FPSCR{};
+	uint32_t FPUL{};
+	uint32_t FR[16]{};	// raw bits, FPSCR.SZ and the FR bank aren't looked at
+
+	uint32_t exitAddress{ 1 };	// stops when the pc gets here, odd so it's never hit by default
+	uint64_t steps{};
+	Stop stopReason{};
+
+	// (jmp/jsr/braf/bsrf address << 32) | where it went
+	std::unordered_set<uint64_t> indirectJumps;
+
+	Interpreter()
+	{
+		pages.resize(size_t(1) << (29 - pageBits));
+		recentBlocks.fill({ 1, nullptr });
+
+		SR = 0x700000F0;
+		FPSCR = 0x00040001;
+	}
+
+	// copies 'size' bytes to 'address' and back out again
+	void load(uint32_t address, const void* data, size_t size);
+	void save(uint32_t address, void* data, size_t size) const;
+
+	Stop run(uint64_t maxSteps);
+
+	template <typename T>
+	T read(uint32_t address) const
+	{
+		// real hardware raises an address error on misaligned accesses
+		const uint32_t physical = (address & ~uint32_t(sizeof(T) - 1)) & 0x1FFFFFFF;
+		const auto* page = pages[physical >> pageBits].get();
+		T value{};
+
+		if (page)
+			memcpy(&value, page->bytes + (physical & (pageSize - 1)), sizeof(T));
+
+		return value;
+	}
+
+	template <typename T>
+	void write(uint32_t address, T value)
+	{
+		const uint32_t physical = (address & ~uint32_t(sizeof(T) - 1)) & 0x1FFFFFFF;
+		auto& page = pages[physical >> pageBits];
+
+		if (!page)
+			page = std::make_unique<Page>();
+
+		const uint32_t offset = physical & (pageSize - 1);
+		memcpy(page->bytes + offset, &value, sizeof(T));
+
+		// the blocks are thrown away once the current one is done
+		if ((page->codeLines[offset >> lineBits >> 6] >> ((offset >> lineBits) & 63)) & 1)
+		{
+			codeWritten = true;
+			interrupt = true;
+		}
+	}
+
+	// the names the reference code uses
+	uint32_t Read_8(uint32_t address) const { return read<uint8_t>(address); }
+	uint32_t Read_16(uint32_t address) const { return read<uint16_t>(address); }
+	uint32_t Read_32(uint32_t address) const { return read<uint32_t>(address); }
+	void Write_8(uint32_t address, uint32_t value) { write(address, uint8_t(value)); }
+	void Write_16(uint32_t address, uint32_t value) { write(address, uint16_t(value)); }
+	void Write_32(uint32_t address, uint32_t value) { write(address, value); }
+	void Delay_Slot(uint32_t address);
+
+	// caches aren't modelled so all of these do nothing
+	static constexpr int MISS = 0;
+	void invalidate_instruction_cache_block(uint32_t) {}
+	void invalidate_operand_cache_block(uint32_t) {}
+	void prefetch_operand_cache_block(uint32_t) {}
+	void prefetch_instruction_cache_block(uint32_t) {}
+	void allocate_operand_cache_block(uint32_t) {}
+	void write_back(uint32_t) {}
+	bool is_dirty_block(uint32_t) const { return false; }
+	bool is_write_back_memory(uint32_t) const { return false; }
+	int look_up_in_operand_cache(uint32_t) const { return MISS; }
+
+	void undefined_operation() { stop(Stop::Unsupported); }
+	void Sleep_standby() { stop(Stop::Sleep); }
+
+	void stop(Stop reason)
+	{
+		stopReason = reason;
+		interrupt = true;
+	}
+
+	// one per instruction in inst.inl, the ones code.inl doesn't specialise stop
+	template <size_t index>
+	void execute(uint16_t code);
+
+	template <size_t index>
+	static void call(Interpreter& interpreter, uint16_t code)
+	{
+		interpreter.execute<index>(code);
+	}
+
+	template <size_t... indices>
+	static constexpr std::array<Handler, sizeof...(indices)> makeHandlers(std::index_sequence<indices...>)
+	{
+		return { &call<indices>... };
+	}
+
+private:
+	const Block* getBlock(uint32_t address);
+	bool buildBlock(uint32_t address, Block& block);
+	void flushBlocks();
+
+	std::vector<std::unique_ptr<Page>> pages;
+	std::unordered_map<uint32_t, Block> blocks;
+
+	// direct mapped in front of 'blocks', most jumps go somewhere recent
+	struct RecentBlock
+	{
+		uint32_t address;
+		const Block* block;
+	};
+
+	std::array<RecentBlock, 4096> recentBlocks;
+
+	bool interrupt{};	// leave the current block early
+	bool codeWritten{};
+};
+
+template <size_t index>
+inline void Interpreter::execute(uint16_t)
+{
+	stop(Stop::Unsupported);
+}
+
+#include "code.inl"
+
+// indexed by the decoder's op id
+inline constexpr auto interpreterHandlers = Interpreter::makeHandlers(std::make_index_sequence<Decoder::instructionCount>());
+
+inline void Interpreter::load(uint32_t address, const void* data, size_t size)
+{
+	const auto* bytes = static_cast<const uint8_t*>(data);
+
+	while (size)
+	{
+		const uint32_t physical = address & 0x1FFFFFFF;
+		const uint32_t offset = physical & (pageSize - 1);
+		const size_t count = std::min<size_t>(size, pageSize - offset);
+		auto& page = pages[physical >> pageBits];
+
+		if (!page)
+			page = std::make_unique<Page>();
+
+		memcpy(page->bytes + offset, bytes, count);
+
+		address += uint32_t(count);
+		bytes += count;
+		size -= count;
+	}
+
+	flushBlocks();
+}
+
+inline void Interpreter::save(uint32_t address, void* data, size_t size) const
+{
+	auto* bytes = static_cast<uint8_t*>(data);
+
+	while (size)
+	{
+		const uint32_t physical = address & 0x1FFFFFFF;
+		const uint32_t offset = physical & (pageSize - 1);
+		const size_t count = std::min<size_t>(size, pageSize - offset);
+
+		if (const auto* page = pages[physical >> pageBits].get())
+			memcpy(bytes, page->bytes + offset, count);
+		else
+			memset(bytes, 0, count);
+
+		address += uint32_t(count);
+		bytes += count;
+		size -= count;
+	}
+}
+
+// the reference code has already set the pc to the branch target, the slot
+// runs at its own address so pc relative loads in it work
+inline void Interpreter::Delay_Slot(uint32_t address)
+{
+	const uint32_t target = PC;
+	const uint16_t code = read<uint16_t>(address);
+	const auto id = Decoder::dispatch[code];
+
+	PC = address;
+
+	if (instructionFlows[id] != Flow::None && instructionFlows[id] != Flow::Invalid)
+	{
+		stop(Stop::SlotIllegal);
+		return;
+	}
+
+	interpreterHandlers[id](*this, code);
+
+	// if the slot couldn't run the pc is left on it
+	if (stopReason == Stop::None)
+	{
+		PC = target;
+		steps++;
+	}
+}
+
+inline bool Interpreter::buildBlock(uint32_t address, Block& block)
+{
+	if ((address & 1) || !pages[(address & 0x1FFFFFFF) >> pageBits])
+		return false;
+
+	block.start = address;
+
+	for (uint32_t pc = address; block.insts.size() < maxBlockLength; pc += 2)
+	{
+		const uint16_t code = read<uint16_t>(pc);
+		const auto id = Decoder::dispatch[code];
+
+		if (auto* page = pages[(pc & 0x1FFFFFFF) >> pageBits].get())
+		{
+			const uint32_t line = (pc & (pageSize - 1)) >> lineBits;
+			page->codeLines[line >> 6] |= 1ull << (line & 63);
+		}
+
+		block.insts.push_back({ interpreterHandlers[id], code });
+		block.flow = instructionFlows[id];
+
+		if (block.flow != Flow::None)
+			break;
+	}
+
+	return true;
+}
+
+inline const Interpreter::Block* Interpreter::getBlock(uint32_t address)
+{
+	auto& recent = recentBlocks[(address >> 1) & (recentBlocks.size() - 1)];
+
+	if (recent.address == address)
+		return recent.block;
+
+	auto [it, inserted] = blocks.try_emplace(address);
+
+	if (inserted && !buildBlock(address, it->second))
+	{
+		blocks.erase(it);
+		return nullptr;
+	}
+
+	recent = { address, &it->second };
+	return &it->second;
+}
+
+inline void Interpreter::flushBlocks()
+{
+	blocks.clear();
+	recentBlocks.fill({ 1, nullptr });
+
+	for (auto& page : pages)
+		if (page)
+			memset(page->codeLines, 0, sizeof(page->codeLines));
+
+	codeWritten = false;
+}
+
+inline Interpreter::Stop Interpreter::run(uint64_t maxSteps)
+{
+	const uint64_t lastStep = steps + maxSteps;
+	stopReason = Stop::None;
+
+	while (true)
+	{
+		if (codeWritten)
+			flushBlocks();
+
+		interrupt = false;
+
+		if (PC == exitAddress)
+			stop(Stop::Returned);
+		else if (steps >= lastStep)
+			stop(Stop::Steps);
+
+		if (stopReason != Stop::None)
+			break;
+
+		const auto* block = getBlock(PC);
+
+		if (!block)
+		{
+			stop(Stop::Fetch);
+			break;
+		}
+
+		const auto* inst = block->insts.data();
+		const auto* end = inst + block->insts.size();
+
+		// one indirect call per instruction, back here in between
+		while (inst != end && !interrupt)
+		{
+			inst->handler(*this, inst->code);
+			inst++;
+		}
+
+		const auto ran = uint32_t(inst - block->insts.data());
+		steps += ran;
+
+		// one that couldn't run doesn't count
+		if (stopReason == Stop::Unsupported && PC == block->start + (ran - 1) * 2)
+			steps--;
+
+		if (inst == end && stopReason == Stop::None && (block->flow == Flow::Jump || block->flow == Flow::CallIndirect))
+			indirectJumps.insert((uint64_t(block->start + (block->insts.size() - 1) * 2) << 32) | PC);
+	}
+
+	return stopReason;
+}
@@ -0,0 +1,401 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <chrono>
+#include <bit>
+
+#include "image.h"
+#include "decoder.h"
+#include "classify.h"
+#include "symbols.h"
+
+// marks the pool words read by pc relative loads in [position, position + count * 2)
+inline void markLiteralPools(CodeDataMap& map, const ImageView& view, uint64_t position, size_t count)
+{
+	uint16_t opIds[1024];
+	map.dataWords.resize(view.words.size());
+
+	for (size_t block = 0; block < count; block += std::size(opIds))
+	{
+		const auto blockCount = std::min(std::size(opIds), count - block);
+		const auto first = (position - view.offset) / 2 + block;
+
+		Decoder::decodeBatch(view.words.data() + first, blockCount, opIds);
+
+		for (size_t i = 0; i < blockCount; i++)
+		{
+			const auto literal = instructionLiterals[opIds[i]];
+
+			if (literal != Literal::Word && literal != Literal::Long)
+				continue;
+
+			const auto loadPosition = view.offset + (first + i) * 2;
+			const auto pool = uint32_t(getLiteralAddress(literal, view.words[first + i], view.getAddress(loadPosition)) - view.base);
+
+			for (uint64_t word = 0; word < (literal == Literal::Long ? 2 : 1); word++)
+				if (view.contains(pool + word * 2))
+					map.dataWords[(pool + word * 2 - view.offset) / 2] = true;
+		}
+	}
+}
+
+inline char* writeHex(char* dst, uint64_t value, int minDigits)
+{
+	static const char digits[] = "0123456789ABCDEF";
+
+	int count = minDigits;
+	while (count < 16 && (value >> (count * 4)))
+		count++;
+
+	for (int i = count - 1; i >= 0; i--)
+		*dst++ = digits[(value >> (i * 4)) & 0xF];
+
+	return dst;
+}
+
+// how many words get formatted before the text is handed to the file
+inline constexpr size_t listingChunkWords = 64 * 1024;
+
+// the text of every possible opcode, formatted once through inst.inl the first
+// time anything is listed. about 1.5MB, after that a line is a memcpy away
+struct OpcodeText
+{
+	std::vector<uint32_t> offsets;	// where each opcode's text starts in 'text', plus one for the end
+	std::vector<char> text;
+
+	OpcodeText()
+	{
+		char buffer[128]{};
+
+		offsets.reserve(0x10000 + 1);
+		text.reserve(0x10000 * 24);
+
+		for (size_t op = 0; op < 0x10000; op++)
+		{
+			const int length = Decoder::format(Decoder::decodedTable[op], buffer, sizeof(buffer));
+
+			offsets.push_back(uint32_t(text.size()));
+			text.insert(text.end(), buffer, buffer + std::clamp(length, 0, int(sizeof(buffer) - 1)));
+		}
+
+		offsets.push_back(uint32_t(text.size()));
+	}
+
+	// copies the text of 'op' to 'dst' and returns the end of it
+	char* write(char* dst, uint16_t op) const
+	{
+		const auto start = offsets[op];
+		const auto length = offsets[op + 1] - start;
+
+		memcpy(dst, text.data() + start, length);
+		return dst + length;
+	}
+
+	// built on first use, static initialisation makes that safe from any thread
+	static const OpcodeText& get()
+	{
+		static const OpcodeText table;
+		return table;
+	}
+};
+
+// appends ' <name>' or ' <name+0xoffset>' if 'address' has a symbol
+inline char* writeSymbol(char* dst, const SymbolIndex& symbols, uint32_t address)
+{
+	uint32_t offset{};
+	const auto* symbol = symbols.find(address, offset);
+
+	if (!symbol)
+		return dst;
+
+	*dst++ = ' ';
+	*dst++ = '<';
+	memcpy(dst, symbol->name.data(), symbol->name.size());
+	dst += symbol->name.size();
+
+	if (offset)
+	{
+		*dst++ = '+';
+		*dst++ = '0';
+		*dst++ = 'x';
+		dst = writeHex(dst, offset, 1);
+	}
+
+	*dst++ = '>';
+	return dst;
+}
+
+// appends the resolved constant (or address) a pc relative load refers to,
+// with its name if there are symbols. mov.w constants are left alone, they
+// are numbers far more often than addresses
+inline char* writeLiteral(char* dst, const ImageView& view, Literal literal, uint16_t op, uint64_t address, const SymbolIndex* symbols)
+{
+	const auto pool = getLiteralAddress(literal, op, address);
+	const auto position = uint32_t(pool - view.base);
+
+	*dst++ = '\t';
+	*dst++ = ';';
+	*dst++ = ' ';
+
+	if (literal == Literal::Address)
+	{
+		*dst++ = '0';
+		*dst++ = 'x';
+		dst = writeHex(dst, pool, 8);
+
+		return symbols ? writeSymbol(dst, *symbols, uint32_t(pool)) : dst;
+	}
+
+	*dst++ = '@';
+	*dst++ = '0';
+	*dst++ = 'x';
+	dst = writeHex(dst, pool, 8);
+
+	if (!view.contains(position) || (literal == Literal::Long && !view.contains(position + 2)))
+		return dst;
+
+	uint32_t value = view.getWord(position);
+
+	if (literal == Literal::Long)
+		value |= uint32_t(view.getWord(position + 2)) << 16;
+
+	*dst++ = ' ';
+	*dst++ = '=';
+	*dst++ = ' ';
+	*dst++ = '0';
+	*dst++ = 'x';
+
+	dst = writeHex(dst, value, literal == Literal::Long ? 8 : 4);
+
+	return symbols && literal == Literal::Long ? writeSymbol(dst, *symbols, value) : dst;
+}
+
+// counters for --stats. every thread fills in its own and they are merged at
+// the end, so nothing is shared while listing
+struct ListingStats
+{
+	using Clock = std::chrono::steady_clock;
+
+	// unknown words are counted per 4KB of the image
+	static constexpr size_t pageWords = 2048;
+
+	struct UnknownPage
+	{
+		uint64_t start{};
+		uint64_t end{};
+		uint64_t count{};
+	};
+
+	std::vector<uint64_t> hits = std::vector<uint64_t>(Decoder::instructionCount);
+	std::vector<uint64_t> unknownPages;		// for the view being listed
+	std::vector<UnknownPage> unknownRanges;	// every view listed so far, by address
+	uint64_t dataWords{};
+	Clock::duration decodeTime{};
+	Clock::duration formatTime{};
+
+	void merge(const ListingStats& other)
+	{
+		for (size_t i = 0; i < hits.size(); i++)
+			hits[i] += other.hits[i];
+
+		if (unknownPages.size() < other.unknownPages.size())
+			unknownPages.resize(other.unknownPages.size());
+
+		for (size_t i = 0; i < other.unknownPages.size(); i++)
+			unknownPages[i] += other.unknownPages[i];
+
+		dataWords += other.dataWords;
+		decodeTime += other.decodeTime;
+		formatTime += other.formatTime;
+	}
+
+	// called once a view is done with, the page counts are kept by address
+	void collectPages(const ImageView& view)
+	{
+		for (size_t page = 0; page < unknownPages.size(); page++)
+		{
+			if (!unknownPages[page])
+				continue;
+
+			const auto first = page * pageWords;
+			const auto words = std::min(pageWords, view.words.size() - first);
+			const auto start = view.getAddress(view.offset + first * 2);
+
+			unknownRanges.push_back({ start, start + words * 2, unknownPages[page] });
+		}
+
+		unknownPages.clear();
+	}
+
+	void count(const CodeDataMap& codeData, const DecodedInst* decoded, size_t first, size_t n)
+	{
+		constexpr auto unknownIndex = uint16_t(Decoder::instructionCount - 1);
+
+		for (size_t i = 0; i < n; i++)
+		{
+			if (codeData.isData(first + i))
+			{
+				dataWords++;
+				continue;
+			}
+
+			hits[decoded[i].id]++;
+
+			if (decoded[i].id == unknownIndex)
+				unknownPages[(first + i) / pageWords]++;
+		}
+	}
+};
+
+// formats 'count' words starting at file offset 'position'. with 'symbols'
+// the constants, addresses and branch targets that have a name get it too
+inline void appendWords(std::string& out, const ImageView& view, const CodeDataMap& codeData, uint64_t position, size_t count, ListingStats* stats = nullptr, const SymbolIndex* symbols = nullptr)
+{
+	char line[512]{};
+	DecodedInst decoded[1024];
+	const auto& opcodeText = OpcodeText::get();
+
+	// the text is looked up by the word the decoder saw
+	constexpr bool swapBytes = std::endian::native == std::endian::big;
+
+	const auto first = size_t(position - view.offset) / 2;
+	const auto words = view.words.subspan(first, count);
+	auto address = view.getAddress(position);
+
+	if (stats && stats->unknownPages.size() * ListingStats::pageWords < view.words.size())
+		stats->unknownPages.resize((view.words.size() + ListingStats::pageWords - 1) / ListingStats::pageWords);
+
+	for (size_t block = 0; block < words.size(); block += std::size(decoded))
+	{
+		const size_t blockCount = std::min(std::size(decoded), words.size() - block);
+		const auto decodeStart = stats ? ListingStats::Clock::now() : ListingStats::Clock::time_point{};
+
+		decompsh::decode(words.subspan(block, blockCount), decoded);
+
+		if (stats)
+		{
+			stats->count(codeData, decoded, first + block, blockCount);
+			stats->decodeTime += ListingStats::Clock::now() - decodeStart;
+		}
+
+		const auto formatStart = stats ? ListingStats::Clock::now() : ListingStats::Clock::time_point{};
+
+		for (size_t i = 0; i < blockCount; i++)
+		{
+			const auto op = words[block + i];
+
+			// the prefix is formatted by hand, printf parsing used to dominate here
+			char* dst = line;
+			*dst++ = '0';
+			*dst++ = 'x';
+			dst = writeHex(dst, address, 4);
+			*dst++ = ':';
+			*dst++ = ' ';
+			dst = writeHex(dst, op >> 8, 2);
+			*dst++ = ' ';
+			dst = writeHex(dst, op & 0xFF, 2);
+			*dst++ = ':';
+			*dst++ = '\t';
+
+			if (codeData.isData(first + block + i))
+			{
+				memcpy(dst, ".word         0x", 16);
+				dst = writeHex(dst + 16, op, 4);
+			}
+			else
+			{
+				dst = opcodeText.write(dst, swapBytes ? uint16_t((op >> 8) | (op << 8)) : op);
+
+				if (const auto literal = instructionLiterals[decoded[i].id]; literal != Literal::None)
+				{
+					dst = writeLiteral(dst, view, literal, op, address, symbols);
+				}
+				else if (symbols)
+				{
+					const auto flow = instructionFlows[decoded[i].id];
+
+					if (flow == Flow::Branch || flow == Flow::Call || flow == Flow::CondBranch || flow == Flow::CondBranchDelayed)
+					{
+						const auto target = uint32_t(getBranchTarget(flow, op, address));
+						uint32_t offset{};
+
+						// only named targets are shown, other branches look as they do without symbols
+						if (symbols->find(target, offset))
+						{
+							memcpy(dst, "\t; 0x", 5);
+							dst = writeSymbol(writeHex(dst + 5, target, 8), *symbols, target);
+						}
+					}
+				}
+			}
+
+			*dst++ = '\n';
+
+			out.append(line, dst - line);
+			address += 2;
+		}
+
+		if (stats)
+			stats->formatTime += ListingStats::Clock::now() - formatStart;
+	}
+}
+
+// like appendWords(), but runs of windows classified as data get one line
+// each instead, written by whichever call lists the start of the run
+inline void appendListing(std::string& out, const ImageView& view, const CodeDataMap& codeData, uint64_t position, size_t count, ListingStats* stats = nullptr, const SymbolIndex* symbols = nullptr)
+{
+	if (codeData.dataWindows.empty())
+	{
+		appendWords(out, view, codeData, position, count, stats, symbols);
+		return;
+	}
+
+	constexpr size_t windowWords = classifyWindowWords;
+
+	const auto first = size_t(position - view.offset) / 2;
+	const auto end = first + count;
+
+	for (size_t i = first; i < end;)
+	{
+		size_t window = i / windowWords;
+
+		if (!codeData.isDataWindow(window))
+		{
+			while (window * windowWords < end && !codeData.isDataWindow(window))
+				window++;
+
+			const auto codeEnd = std::min(end, window * windowWords);
+			appendWords(out, view, codeData, view.offset + i * 2, codeEnd - i, stats, symbols);
+
+			i = codeEnd;
+			continue;
+		}
+
+		size_t runStart = window;
+		size_t runEnd = window;
+
+		while (runStart && codeData.isDataWindow(runStart - 1))
+			runStart--;
+
+		while (codeData.isDataWindow(runEnd))
+			runEnd++;
+
+		const auto startWord = runStart * windowWords;
+		const auto endWord = std::min(runEnd * windowWords, view.words.size());
+
+		if (startWord >= first)
+		{
+			char line[96]{};
+			out.append(line, snprintf(line, sizeof(line), "0x%08llX - 0x%08llX: data, %zu bytes\n",
+				(unsigned long long)view.getAddress(view.offset + startWord * 2),
+				(unsigned long long)view.getAddress(view.offset + endWord * 2),
+				(endWord - startWord) * 2));
+		}
+
+		i = std::min(end, endWord);
+	}
+}
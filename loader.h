@@ -0,0 +1,406 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <memory>
+
+#include "image.h"
+
+// where the code in a file ends up in memory. loading only reads the headers,
+// the bytes of a segment are mapped straight from the file when it's listed
+// (apart from scrambled images, which have to be unscrambled up front, and
+// images that have been run)
+struct Segment
+{
+	std::string name;
+	uint32_t address{};
+	uint64_t fileOffset{};
+	uint64_t size{};
+};
+
+struct Program
+{
+	std::string path;
+	std::vector<Segment> segments;	// only the executable ones
+	std::vector<uint16_t> image;	// the whole file when it's held in memory instead of mapped, by file offset
+	uint32_t entry{};
+	bool hasEntry{};
+};
+
+// the layout of the 32 bit ELF structures, SH is little endian like the host
+struct ElfHeader
+{
+	uint8_t ident[16];
+	uint16_t type;
+	uint16_t machine;
+	uint32_t version;
+	uint32_t entry;
+	uint32_t programHeaderOffset;
+	uint32_t sectionHeaderOffset;
+	uint32_t flags;
+	uint16_t headerSize;
+	uint16_t programHeaderSize;
+	uint16_t programHeaderCount;
+	uint16_t sectionHeaderSize;
+	uint16_t sectionHeaderCount;
+	uint16_t sectionNameIndex;
+};
+
+struct ElfSection
+{
+	uint32_t name;
+	uint32_t type;
+	uint32_t flags;
+	uint32_t address;
+	uint32_t offset;
+	uint32_t size;
+	uint32_t link;
+	uint32_t info;
+	uint32_t alignment;
+	uint32_t entrySize;
+};
+
+struct ElfSymbol
+{
+	uint32_t name;
+	uint32_t value;
+	uint32_t size;
+	uint8_t info;
+	uint8_t other;
+	uint16_t sectionIndex;
+};
+
+static_assert(sizeof(ElfHeader) == 52 && sizeof(ElfSection) == 40 && sizeof(ElfSymbol) == 16);
+
+inline constexpr uint16_t elfMachineSh = 42;
+inline constexpr uint32_t elfSectionProgBits = 1;
+inline constexpr uint32_t elfSectionSymbols = 2;
+inline constexpr uint32_t elfFlagAlloc = 0x2;
+inline constexpr uint32_t elfFlagExecute = 0x4;
+inline constexpr uint8_t elfSymbolFunction = 2;
+
+// 1ST_READ.BIN is loaded here by the Dreamcast boot rom
+inline constexpr uint32_t firstReadAddress = 0x8C010000;
+
+// fseek and ftell take a long, which is only 32 bits on Windows
+inline bool seekFile(FILE* file, uint64_t offset, int origin = SEEK_SET)
+{
+#ifdef _WIN32
+	return _fseeki64(file, int64_t(offset), origin) == 0;
+#else
+	return fseeko(file, off_t(offset), origin) == 0;
+#endif
+}
+
+inline bool getFileSize(FILE* file, uint64_t& size)
+{
+	if (!seekFile(file, 0, SEEK_END))
+		return false;
+
+#ifdef _WIN32
+	const int64_t position = _ftelli64(file);
+#else
+	const int64_t position = int64_t(ftello(file));
+#endif
+
+	size = uint64_t(position);
+	return position >= 0;
+}
+
+inline bool readFileRange(FILE* file, uint64_t offset, void* dst, size_t size)
+{
+	return seekFile(file, offset) && fread(dst, 1, size, file) == size;
+}
+
+inline bool isElf(const std::string& path)
+{
+	char magic[4]{};
+	auto* file = fopen(path.c_str(), "rb");
+
+	if (!file)
+		return false;
+
+	const bool elf = readFileRange(file, 0, magic, sizeof(magic)) && !memcmp(magic, "\x7F" "ELF", 4);
+	fclose(file);
+
+	return elf;
+}
+
+// whether [offset, offset + size) is inside a file of 'fileSize' bytes
+inline bool isInFile(uint64_t offset, uint64_t size, uint64_t fileSize)
+{
+	return offset <= fileSize && size <= fileSize - offset;
+}
+
+// the section headers and their names, nothing else in the file is read.
+// nothing is allocated for a table that goes past the end of the file
+inline bool readElfSections(FILE* file, ElfHeader& header, std::vector<ElfSection>& sections, std::string& names, uint64_t& fileSize)
+{
+	if (!getFileSize(file, fileSize) || !readFileRange(file, 0, &header, sizeof(header)))
+		return false;
+
+	if (header.ident[4] != 1 || header.ident[5] != 1 || header.machine != elfMachineSh || header.sectionHeaderSize != sizeof(ElfSection))
+	{
+		fprintf(stderr, "only 32 bit little endian SH ELF files are supported\n");
+		return false;
+	}
+
+	if (!isInFile(header.sectionHeaderOffset, uint64_t(header.sectionHeaderCount) * sizeof(ElfSection), fileSize))
+		return false;
+
+	sections.resize(header.sectionHeaderCount);
+
+	if (!readFileRange(file, header.sectionHeaderOffset, sections.data(), sections.size() * sizeof(ElfSection)))
+		return false;
+
+	if (header.sectionNameIndex < sections.size())
+	{
+		const auto& nameSection = sections[header.sectionNameIndex];
+
+		if (!isInFile(nameSection.offset, nameSection.size, fileSize))
+			return false;
+
+		names.resize(nameSection.size);
+
+		if (!readFileRange(file, nameSection.offset, names.data(), names.size()))
+			return false;
+	}
+
+	names.push_back('\0');
+	return true;
+}
+
+inline bool loadElf(const std::string& path, Program& program)
+{
+	auto* file = fopen(path.c_str(), "rb");
+
+	if (!file)
+	{
+		fprintf(stderr, "couldn't open '%s'\n", path.c_str());
+		return false;
+	}
+
+	ElfHeader header{};
+	std::vector<ElfSection> sections;
+	std::string names;
+	uint64_t fileSize{};
+
+	const bool loaded = readElfSections(file, header, sections, names, fileSize);
+	fclose(file);
+
+	if (!loaded)
+	{
+		fprintf(stderr, "couldn't read the ELF headers of '%s'\n", path.c_str());
+		return false;
+	}
+
+	program.path = path;
+	program.entry = header.entry;
+	program.hasEntry = true;
+
+	for (const auto& section : sections)
+	{
+		if (section.type != elfSectionProgBits || (section.flags & (elfFlagAlloc | elfFlagExecute)) != (elfFlagAlloc | elfFlagExecute))
+			continue;
+
+		const char* name = names.c_str() + std::min<size_t>(section.name, names.size() - 1);
+
+		if (!isInFile(section.offset, section.size, fileSize))
+		{
+			fprintf(stderr, "section '%s' of '%s' goes past the end of the file\n", name, path.c_str());
+			return false;
+		}
+
+		program.segments.push_back({ name, section.address, section.offset, section.size });
+	}
+
+	if (program.segments.empty())
+	{
+		fprintf(stderr, "'%s' has no executable sections\n", path.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+// looks a function up in the symbol table, only the symbol and string tables are read
+inline bool findElfFunction(const std::string& path, const std::string& name, uint32_t& address, uint32_t& size)
+{
+	auto* file = fopen(path.c_str(), "rb");
+
+	if (!file)
+		return false;
+
+	ElfHeader header{};
+	std::vector<ElfSection> sections;
+	std::string names;
+	uint64_t fileSize{};
+	bool found = false;
+
+	if (readElfSections(file, header, sections, names, fileSize))
+	{
+		for (const auto& section : sections)
+		{
+			if (section.type != elfSectionSymbols || section.link >= sections.size() || found)
+				continue;
+
+			if (!isInFile(section.offset, section.size, fileSize) || !isInFile(sections[section.link].offset, sections[section.link].size, fileSize))
+				continue;
+
+			std::vector<ElfSymbol> symbols(section.size / sizeof(ElfSymbol));
+			std::string strings(sections[section.link].size, '\0');
+
+			if (!readFileRange(file, section.offset, symbols.data(), symbols.size() * sizeof(ElfSymbol)) ||
+				!readFileRange(file, sections[section.link].offset, strings.data(), strings.size()))
+				continue;
+
+			for (const auto& symbol : symbols)
+			{
+				if ((symbol.info & 0xF) == elfSymbolFunction && symbol.name < strings.size() && name == strings.c_str() + symbol.name)
+				{
+					// bit 0 is never set on SH but mask it like the linker does
+					address = symbol.value & ~1u;
+					size = symbol.size;
+					found = true;
+					break;
+				}
+			}
+		}
+	}
+
+	fclose(file);
+	return found;
+}
+
+// the whole file at 'base', optionally only the file offsets [start, end)
+inline bool loadRaw(const std::string& path, uint32_t base, uint64_t start, uint64_t end, Program& program)
+{
+	auto* file = fopen(path.c_str(), "rb");
+
+	if (!file)
+	{
+		fprintf(stderr, "couldn't open '%s'\n", path.c_str());
+		return false;
+	}
+
+	uint64_t fileSize{};
+	const bool sized = getFileSize(file, fileSize);
+	fclose(file);
+
+	if (!sized)
+	{
+		fprintf(stderr, "couldn't get the size of '%s'\n", path.c_str());
+		return false;
+	}
+
+	end = std::min(end, fileSize);
+
+	if (start >= end)
+	{
+		fprintf(stderr, "nothing to disassemble in '%s'\n", path.c_str());
+		return false;
+	}
+
+	program.path = path;
+	program.segments.push_back({ "", uint32_t(base + start), start, end - start });
+
+	return true;
+}
+
+// 1ST_READ.BIN is shuffled in 32 byte slices by a seeded PRNG (the same one
+// scramble.c from the homebrew scene uses), largest chunks first. this can't
+// be done lazily since every slice can end up anywhere in its chunk
+inline void unscramble(const uint8_t* src, uint8_t* dst, size_t size)
+{
+	constexpr size_t maxChunk = 2048 * 1024;
+
+	uint32_t seed = size & 0xFFFF;
+	auto random = [&]()
+	{
+		seed = (seed * 2109 + 9273) & 0x7FFF;
+		return (seed + 0xC000) & 0xFFFF;
+	};
+
+	std::vector<uint32_t> slices(maxChunk / 32);
+	size_t remaining = size;
+
+	for (size_t chunkSize = maxChunk; chunkSize >= 32; chunkSize >>= 1)
+	{
+		while (remaining >= chunkSize)
+		{
+			const size_t sliceCount = chunkSize / 32;
+
+			for (size_t i = 0; i < sliceCount; i++)
+				slices[i] = uint32_t(i);
+
+			for (size_t i = sliceCount; i-- > 0;)
+			{
+				const size_t swap = (random() * i) >> 16;
+				std::swap(slices[i], slices[swap]);
+
+				memcpy(dst + slices[i] * 32, src, 32);
+				src += 32;
+			}
+
+			dst += chunkSize;
+			remaining -= chunkSize;
+		}
+	}
+
+	memcpy(dst, src, remaining);
+}
+
+inline bool loadScrambled(const std::string& path, uint32_t base, Program& program)
+{
+	const MappedFile file(path);
+
+	if (!file.isValid())
+	{
+		fprintf(stderr, "couldn't map '%s'\n", path.c_str());
+		return false;
+	}
+
+	program.path = path;
+	program.image.resize(size_t(file.size + 1) / 2);
+	unscramble(file.data, reinterpret_cast<uint8_t*>(program.image.data()), size_t(file.size));
+
+	program.entry = base;
+	program.hasEntry = true;
+	program.segments.push_back({ "", base, 0, file.size & ~1ull });
+
+	return true;
+}
+
+// a view of the part of 'segment' that falls inside the addresses [start, end).
+// 'mapping' keeps the file mapped for as long as the view is used
+inline bool mapSegment(const Program& program, const Segment& segment, uint64_t start, uint64_t end, std::unique_ptr<MappedFile>& mapping, ImageView& view)
+{
+	const uint64_t segmentEnd = uint64_t(segment.address) + segment.size;
+	start = std::max<uint64_t>(start, segment.address);
+	end = std::min(end, segmentEnd);
+
+	if (start >= end)
+		return false;
+
+	const uint64_t first = segment.fileOffset + (start - segment.address);
+	const uint64_t last = segment.fileOffset + (end - segment.address);
+	const uint32_t base = uint32_t(segment.address - segment.fileOffset);
+
+	if (!program.image.empty())
+	{
+		view = { std::span<const uint16_t>(program.image).subspan(size_t(first / 2), size_t((last - first) / 2)), first & ~1ull, base };
+		return true;
+	}
+
+	mapping = std::make_unique<MappedFile>(program.path, first, last);
+
+	if (!mapping->isValid())
+		return false;
+
+	view = { mapping->getWords(), mapping->offset, base };
+	return true;
+}
@@ -1,423 +1,1360 @@
-
-#include <cstdio>
-#include <stack>
-#include <vector>
-#include <string>
-#include <algorithm>
-
-static std::vector<char> readBinaryFile(const std::string& path)
-{
-	std::vector<char> data;
-
-	if (auto* file = fopen(path.c_str(), "rb"))
-	{
-		int fileSize{};
-
-		fseek(file, 0, SEEK_END);
-		fileSize = ftell(file);
-		fseek(file, 0, SEEK_SET);
-
-		if (fileSize > 0)
-		{
-			data.resize(fileSize);
-			fread(data.data(), 1, fileSize, file);
-		}
-
-		fclose(file);
-	}
-
-	return data;
-}
-
-static std::string readTextFile(const std::string& path)
-{
-	std::string string;
-
-	if (auto* file = fopen(path.c_str(), "rb"))
-	{
-		int fileSize{};
-
-		fseek(file, 0, SEEK_END);
-		fileSize = ftell(file);
-		fseek(file, 0, SEEK_SET);
-
-		if (fileSize > 0)
-		{
-			string.resize(fileSize);
-			fread((void*)string.data(), 1, fileSize, file);
-		}
-
-		fclose(file);
-	}
-
-	return string;
-}
-
-static bool writeTextToFile(const std::string& path, const char* text)
-{
-	if (auto* file = fopen(path.c_str(), "w"))
-	{
-		fwrite(text, 1, strlen(text), file);
-		fclose(file);
-
-		return true;
-	}
-
-	return false;
-}
-
-struct State
-{
-	size_t position{};
-};
-
-static std::stack<State> states;
-
-struct Decoder
-{
-	struct DataOffset { int size{}; uint16_t mask{}; };
-
-	struct Inst
-	{
-		const char* decodeString;
-		uint16_t op{};
-		uint16_t decodingMask{};
-		std::initializer_list<DataOffset> dataOffsets;
-		bool valid{ };
-		
-		const char* getDissasembledString(uint16_t inst) const
-		{
-			static char dstString[255]{};
-			
-			int valCount{};
-			unsigned int vals[4]{};
-
-			for (auto data : dataOffsets)
-			{
-				int shiftVal{};
-
-				switch (data.mask)
-				{
-				case 0x000F: 
-				case 0x00FF:
-				case 0x0FFF:
-				case 0xFFFF:
-					shiftVal = 0;	
-					break;
-				
-				case 0x00F0:
-				case 0x0FF0:
-				case 0xFFF0:
-					shiftVal = 4;
-					break;
-				
-				case 0x0F00: 
-				case 0xFF00:
-					shiftVal = 8;	
-					break;
-				
-				case 0xF000:
-					shiftVal = 12; 
-					break;
-				}
-
-				vals[valCount++] = (inst & data.mask) >> shiftVal;
-			}
-
-			// exploit the fact that sprintf ignores unused parameters!!!
-			sprintf(dstString, 
-				decodeString, 
-				vals[0], vals[1], vals[2], vals[3]
-			);
-
-			return dstString;
-		}
-	};
-
-	const std::vector<Inst> instructions;
-
-	static auto buildInstructions()
-	{
-		std::vector<Inst> ops;
-
-#define BITPACK(nib1, nib2, nib3, nib4) 0b##nib1##nib2##nib3##nib4
-
-		using Offset = std::initializer_list<DataOffset>;
-		// the descriptors are in right to left order...
-		// I'm not sure why.. I should check
-		const Offset ____nnnnmmmm____{ { 4, 0x00F0 }, { 4, 0x0F00 } };
-		const Offset ____nnnniiiiiiii{ { 8, 0x00FF }, { 4, 0x0F00 } };
-		const Offset ________dddddddd{ { 8, 0x00FF } };
-		const Offset ____nnnndddddddd{ { 8, 0x00FF }, { 4, 0xF00 } };
-		const Offset ____nnnn________{ { 4, 0x0F00 } };
-		const Offset ____nnnnmmmmdddd{ { 4, 0x000F }, { 4, 0x00F0 }, { 4, 0x0F00 } };
-		const Offset ________mmmmdddd{ { 4, 0x000F }, { 4, 0x00F0 } };
-		const Offset ____dddddddddddd{ { 12, 0x0FFF } };
-		const Offset ____mmmm_nnn____{ { 3, 0x0070 }, { 4, 0x0F00 } };
-		const Offset ____nnn_mmm_____{ { 3, 0x00E0 }, { 3, 0x0E00 } };
-		const Offset ____nnn_mmmm____{ { 4, 0x00F0 }, { 3, 0x0E00 } };
-		const Offset ____nnnnmmm_____{ { 3, 0x00E0 }, { 4, 0x0F00 } };
-		const Offset ____nnmm________{ { 2, 0x0300 }, { 2, 0x0C00 } };
-		const Offset ____nn__________{ { 2, 0x0C00 } };
-		const Offset ____mmm_________{ { 3, 0x0E00 } };
-		const Offset ____nnn_________{ { 3, 0x0E00 } };
-		const Offset ________________{ {} };
-		
-		const Offset ________nnnndddd = ________mmmmdddd;
-		const Offset ____mmmm________ = ____nnnn________;
-		const Offset ________iiiiiiii = ________dddddddd;
-		const Offset ____nnnn_mmm____ = ____mmmm_nnn____;
-
-		// http://www.shared-ptr.com/sh_insns.html
-		#include "inst.inl"
-
-		return ops;
-	}
-
-	Decoder() : 
-		instructions(buildInstructions())
-	{
-	}
-
-	auto decode(uint16_t inst)
-	{
-		for (auto op : instructions)
-		{
-			if ((inst & op.decodingMask) == (op.op & op.decodingMask))
-			{
-				op.valid = true;
-				return op;
-			}
-		}
-
-		return Inst{ "????" };
-	}
-};
-
-static void generateDecoder()
-{
-	struct Op
-	{
-		std::string name;
-		std::string bits;
-		std::string code;
-		//std::string dataLayout;
-	};
-
-	auto stringReplace = [](std::string& string, const char* stringToReplace, const char* stringToInsert)
-	{
-		size_t position{};
-
-		while ((position = string.find(stringToReplace, position)) != std::string::npos)
-			string.replace(position, strlen(stringToReplace), stringToInsert);
-	};
-
-	auto splitString = [](std::string& source, char delim)
-	{
-		std::string dst;
-		size_t pos{};
-
-		if ((pos = source.find(delim)) != std::string::npos)
-		{
-			dst = source.substr(pos);
-			source.replace(pos, dst.length(), "");
-		}
-
-		return dst;
-	};
-
-	// poor mans div element extractor
-	auto extractDiv = [](const std::string& source, int& offset, const char* elemType, const char* name)
-	{
-		std::string contents;
-		size_t start{};
-		size_t end{};
-
-		const auto findString = "class=\"" + std::string(name) + "\">";
-		const auto terminatorString = "</" + std::string(elemType) + ">";
-		if ((start = source.find(findString, offset)) != std::string::npos)
-		{
-			start += findString.length();
-			end = source.find(terminatorString, start);
-
-			contents = source.substr(start, end - start);
-			
-			offset = end;
-
-			return contents;
-		}
-
-		throw std::exception();
-		return std::string();
-	};
-
-	auto createBitString = [](uint16_t val)
-	{
-		using T = uint16_t;
-		static const auto size = sizeof(T) * 8;
-		static char str[size + 1]{};
-
-		for (int i = 0; i < size; i++)
-			str[i] = (val >> (size - i - 1)) & 1 ? '1' : '0';
-
-		return str;
-	};
-
-	auto any = [](const char* src, int size, std::initializer_list<char>&& tokens)
-	{
-		for (int i = 0; i < size; i++)
-			for (auto ch : tokens)
-				if (src[i] == ch)
-					return true;
-
-		return false;
-	};
-
-	int parserOffset = 0;
-	std::string inString;
-	std::string outString;
-	std::vector<Op> ops;
-	
-	outString.reserve(32 * 1024);
-	ops.reserve(512);
-
-	try {
-
-		inString = readTextFile(std::string(PROJECT_PATH) + "/source.html");
-		
-		while (true)
-		{
-			auto supportedChips = extractDiv(inString, parserOffset, "div", "col_cont_1");
-
-			if (supportedChips.find("SH4") != std::string::npos ||
-				supportedChips.find("SH4A") != std::string::npos)
-			{
-				ops.push_back({
-					extractDiv(inString, parserOffset, "div", "col_cont_2"),
-					extractDiv(inString, parserOffset, "div", "col_cont_4"),
-					extractDiv(inString, parserOffset, "p", "precode")
-				});
-			}
-		}
-	}
-	catch (...)
-	{
-	}
-
-	for (auto& op : ops)
-	{
-		uint16_t opBits{};
-		uint16_t opMask{};
-		char bitString[16+1]{};
-
-		const char* s = op.bits.c_str();
-		for (int i = 0; i < 16; i++)
-		{
-			const auto bitIndex = 15 - i;
-
-			switch (s[i])
-			{
-				// 0 and 1 are used to decode the operation type
-			case '0': 
-				opBits |= (0 << bitIndex);
-				opMask |= (1 << bitIndex);
-				bitString[i] = '_';
-				break;
-
-			case '1':
-				opBits |= (1 << bitIndex);
-				opMask |= (1 << bitIndex);
-				bitString[i] = '_';
-				break;
-
-				// n,d,m and i are used as parameters/data
-			case 'n': case 'd': case 'm': case 'i':
-				opBits |= (0 << bitIndex);
-				opMask |= (0 << bitIndex);
-				bitString[i] = s[i];
-				break;
-			}
-		}
-
-		// split the name and args
-		stringReplace(op.name, "\t", " ");
-		auto expr = splitString(op.name, ' ');
-
-		stringReplace(expr, "Rm", "r[%d]");
-		stringReplace(expr, "Rn", "r[%d]");
-		stringReplace(expr, "#imm", "0x%X");
-		stringReplace(expr, "label", "0x%04X");
-		stringReplace(expr, ",", " -> ");
-		
-		char lineBuf[1024]{};
-		sprintf(lineBuf + 0,
-			"ops.push_back({ \"%s                                                       ",
-			op.name.c_str()
-		);
-
-		sprintf(lineBuf + 30,
-			"%s\",                                                                     ",
-			expr.c_str()
-		);
-
-		sprintf(lineBuf + 65,
-			"BITPACK(%.4s, %.4s, %.4s, %.4s), 0x%02X, %s });\n", 
-			createBitString(opBits) + 0,
-			createBitString(opBits) + 4,
-			createBitString(opBits) + 8,
-			createBitString(opBits) + 12,
-			opMask,
-			bitString
-		);
-
-		outString += lineBuf;
-	}
-
-	std::string headerString;
-	std::string codeString;
-
-	headerString += "#pragma once\n\n";
-
-	for (const auto& op : ops)
-	{
-		headerString += op.code.substr(0, op.code.find("\n")) + ";\n";
-		
-		codeString += op.code;
-		codeString += "\n";
-	}
-
-	//writeTextToFile(std::string(PROJECT_PATH) + "/code.h", headerString.c_str());
-	//writeTextToFile(std::string(PROJECT_PATH) + "/code.cc", codeString.c_str());
-	writeTextToFile(std::string(PROJECT_PATH) + "/inst.inl", outString.c_str());
-}
-
-int main(int, const char**)
-{
-	generateDecoder();
-	//return -1;
-
-	auto data = readBinaryFile(std::string(PROJECT_PATH) + "/DC - BIOS.bin");
-
-	State state{};
-	Decoder decoder;
-
-	auto* file = fopen("c:/users/oli/desktop/dis.s", "w");
-
-	while (state.position < data.size())
-	{
-		auto op = *reinterpret_cast<uint16_t*>(data.data() + state.position);
-		auto inst = decoder.decode(op);
-
-		fprintf(file, "0x%04X: %02X %02X:\t%s\n", 
-			state.position, 
-			(op & 0xFF00) >> 8, op & 0x00FF,
-			inst.getDissasembledString(op)
-		);
-		
-		state.position += 2;
-	}
-
-	fclose(file);
-
-	return 0;
-}
\ No newline at end of file
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <stack>
+#include <array>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <span>
+#include <bit>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
+
+#include "image.h"
+#include "decoder.h"
+#include "listing.h"
+#include "cycles.h"
+#include "flow.h"
+#include "loader.h"
+#include "interpreter.h"
+#include "xref.h"
+#include "diff.h"
+#include "signature.h"
+#include "binary.h"
+#include "symbols.h"
+
+// output is appended to large preallocated buffers and full ones are handed to
+// a dedicated thread to write while the other one keeps filling up, so the
+// decoder only ever waits if the disk falls behind by a whole buffer
+struct OutputWriter
+{
+	OutputWriter(FILE* file, size_t bufferSize = 8 * 1024 * 1024) :
+		file(file), bufferSize(bufferSize)
+	{
+		front.reserve(bufferSize * 2);
+		back.reserve(bufferSize * 2);
+
+		thread = std::thread([this] { run(); });
+	}
+
+	~OutputWriter()
+	{
+		flush();
+
+		{
+			std::lock_guard lock(mutex);
+			quit = true;
+		}
+
+		condition.notify_all();
+		thread.join();
+	}
+
+	OutputWriter(const OutputWriter&) = delete;
+	OutputWriter& operator=(const OutputWriter&) = delete;
+
+	// the buffer currently being filled, call commit() when done appending
+	std::string& getBuffer()
+	{
+		return front;
+	}
+
+	void commit()
+	{
+		if (front.size() >= bufferSize)
+			submit();
+	}
+
+	void write(const char* data, size_t size)
+	{
+		front.append(data, size);
+		commit();
+	}
+
+	// hands over whatever is buffered and waits until it has been written
+	void flush()
+	{
+		submit();
+
+		std::unique_lock lock(mutex);
+		condition.wait(lock, [&] { return !pending; });
+
+		fflush(file);
+	}
+
+	// time the writer thread has spent inside fwrite so far
+	std::chrono::steady_clock::duration getWriteTime()
+	{
+		std::lock_guard lock(mutex);
+		return writeTime;
+	}
+
+private:
+	FILE* file{};
+	size_t bufferSize{};
+	std::string front;
+	std::string back;
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool pending{};
+	bool quit{};
+	std::chrono::steady_clock::duration writeTime{};
+
+	void submit()
+	{
+		{
+			std::unique_lock lock(mutex);
+			condition.wait(lock, [&] { return !pending; });
+
+			front.swap(back);
+			pending = true;
+		}
+
+		condition.notify_all();
+		front.clear();
+	}
+
+	void run()
+	{
+		std::unique_lock lock(mutex);
+
+		while (true)
+		{
+			condition.wait(lock, [&] { return pending || quit; });
+
+			if (pending)
+			{
+				lock.unlock();
+				const auto start = std::chrono::steady_clock::now();
+				fwrite(back.data(), 1, back.size(), file);
+				const auto elapsed = std::chrono::steady_clock::now() - start;
+				lock.lock();
+
+				writeTime += elapsed;
+				pending = false;
+				condition.notify_all();
+			}
+			else
+			{
+				return;
+			}
+		}
+	}
+};
+
+// the image is cut into chunks that workers decode and format on their own,
+// the calling thread then writes them back out in address order. only a
+// small window of chunks is in flight so memory use stays flat
+static void disassembleParallel(const ImageView& view, const CodeDataMap& codeData, int threadCount, OutputWriter& writer, ListingStats* stats, const SymbolIndex* symbols)
+{
+	const auto& words = view.words;
+	const size_t chunkCount = (words.size() + listingChunkWords - 1) / listingChunkWords;
+	const size_t window = size_t(threadCount) * 2;
+
+	std::vector<std::string> chunks(window);
+	std::vector<bool> ready(window);
+	std::mutex mutex;
+	std::condition_variable condition;
+	size_t nextChunk{};
+	size_t writtenChunks{};
+
+	auto worker = [&]()
+	{
+		ListingStats threadStats;
+
+		while (true)
+		{
+			size_t index{};
+
+			{
+				std::unique_lock lock(mutex);
+				condition.wait(lock, [&] { return nextChunk >= chunkCount || nextChunk < writtenChunks + window; });
+
+				if (nextChunk >= chunkCount)
+				{
+					if (stats)
+						stats->merge(threadStats);
+
+					return;
+				}
+
+				index = nextChunk++;
+			}
+
+			auto& text = chunks[index % window];
+			const auto count = std::min(listingChunkWords, words.size() - index * listingChunkWords);
+
+			text.clear();
+			appendListing(text, view, codeData, view.offset + index * listingChunkWords * 2, count, stats ? &threadStats : nullptr, symbols);
+
+			{
+				std::lock_guard lock(mutex);
+				ready[index % window] = true;
+			}
+
+			condition.notify_all();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < threadCount; i++)
+		threads.emplace_back(worker);
+
+	for (size_t index = 0; index < chunkCount; index++)
+	{
+		{
+			std::unique_lock lock(mutex);
+			condition.wait(lock, [&] { return bool(ready[index % window]); });
+		}
+
+		// the slot is only reused once writtenChunks moves past it
+		const auto& text = chunks[index % window];
+		writer.write(text.data(), text.size());
+
+		{
+			std::lock_guard lock(mutex);
+			ready[index % window] = false;
+			writtenChunks++;
+		}
+
+		condition.notify_all();
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+}
+
+// lists only the traced blocks, with a label in front of each function. a
+// function that starts where a symbol does is labelled with its name
+static void appendFlowListing(OutputWriter& writer, const ImageView& view, const CodeDataMap& codeData, const FlowGraph& graph, ListingStats* stats, const SymbolIndex* symbols)
+{
+	uint64_t previousEnd = UINT64_MAX;
+
+	for (const auto& block : graph.blocks)
+	{
+		auto& out = writer.getBuffer();
+		const bool isFunction = std::binary_search(graph.functions.begin(), graph.functions.end(), block.start);
+
+		if ((isFunction || block.start != previousEnd) && previousEnd != UINT64_MAX)
+			out += '\n';
+
+		if (isFunction)
+		{
+			const auto address = uint32_t(view.getAddress(block.start));
+			uint32_t offset{};
+			const auto* symbol = symbols ? symbols->find(address, offset) : nullptr;
+			char label[32]{};
+
+			if (symbol && !offset)
+				out.append(symbol->name).append(":\n");
+			else
+				out.append(label, snprintf(label, sizeof(label), "sub_%08X:\n", address));
+		}
+
+		appendListing(out, view, codeData, block.start, (block.end - block.start) / 2, stats, symbols);
+		writer.commit();
+
+		previousEnd = block.end;
+	}
+}
+
+// one line per block with its estimated timing. blocks that branch back to
+// themselves or somewhere earlier are flagged since that's where loops are
+static void appendCycleReport(OutputWriter& writer, const ImageView& view, std::span<const DecodedInst> decoded, const FlowGraph& graph)
+{
+	char line[160]{};
+
+	int length = snprintf(line, sizeof(line), "%-10s   %-10s %7s %8s %8s %8s\n", "start", "end", "insts", "cycles", "stalls", "paired");
+	writer.write(line, size_t(length));
+
+	for (const auto& block : graph.blocks)
+	{
+		const auto first = size_t(block.start - view.offset) / 2;
+		const auto count = size_t(block.end - block.start) / 2;
+		const auto timing = estimateCycles(decoded.subspan(first, count));
+
+		bool loop = false;
+		for (int i = 0; i < block.successorCount; i++)
+			loop |= block.successors[i] <= block.start;
+
+		length = snprintf(line, sizeof(line), "0x%08llX - 0x%08llX %7zu %8llu %8llu %8llu%s\n",
+			(unsigned long long)view.getAddress(block.start),
+			(unsigned long long)view.getAddress(block.end),
+			count,
+			(unsigned long long)timing.cycles,
+			(unsigned long long)timing.stallCycles,
+			(unsigned long long)timing.pairs,
+			loop ? "   loop" : "");
+
+		writer.write(line, size_t(length));
+	}
+}
+
+using Seconds = std::chrono::duration<double>;
+
+struct Phase
+{
+	const char* name;
+	std::chrono::steady_clock::duration time;
+};
+
+static void writeJsonString(FILE* file, const char* string)
+{
+	fputc('"', file);
+
+	for (; *string; string++)
+	{
+		if (*string == '"' || *string == '\\')
+			fputc('\\', file);
+
+		fputc(*string, file);
+	}
+
+	fputc('"', file);
+}
+
+// everything --stats collected as one JSON object. decode and format are
+// summed over all threads so with --threads they can add up to more than total
+static void writeStats(FILE* file, const std::string& inputPath, uint64_t words, const ListingStats& stats, std::span<const Phase> phases, std::chrono::steady_clock::duration total)
+{
+	uint64_t listedWords = stats.dataWords;
+	for (auto hits : stats.hits)
+		listedWords += hits;
+
+	fprintf(file, "{\n\t\"image\": ");
+	writeJsonString(file, inputPath.c_str());
+	fprintf(file, ",\n\t\"words\": %llu,\n\t\"listed_words\": %llu,\n\t\"data_words\": %llu,\n",
+		(unsigned long long)words, (unsigned long long)listedWords, (unsigned long long)stats.dataWords);
+
+	fprintf(file, "\t\"seconds\": {");
+	for (const auto& phase : phases)
+		fprintf(file, " \"%s\": %.6f,", phase.name, Seconds(phase.time).count());
+	fprintf(file, " \"total\": %.6f },\n", Seconds(total).count());
+
+	fprintf(file, "\t\"words_per_second\": %.0f,\n", listedWords / std::max(Seconds(total).count(), 1e-9));
+
+	fprintf(file, "\t\"instructions\": [");
+	for (size_t i = 0; i < stats.hits.size(); i++)
+	{
+		const auto& inst = Decoder::instructions[i];
+
+		fprintf(file, "%s\n\t\t{ \"index\": %zu, \"op\": %u, \"mask\": %u, \"format\": ", i ? "," : "", i, inst.op, inst.decodingMask);
+		writeJsonString(file, inst.decodeString);
+		fprintf(file, ", \"hits\": %llu }", (unsigned long long)stats.hits[i]);
+	}
+	fprintf(file, "\n\t],\n");
+
+	// only the 4KB pages that had any unknown words in them
+	fprintf(file, "\t\"unknown\": { \"words\": %llu, \"pages\": [", (unsigned long long)stats.hits.back());
+
+	bool firstPage = true;
+	for (const auto& page : stats.unknownRanges)
+	{
+		fprintf(file, "%s\n\t\t{ \"start\": %llu, \"end\": %llu, \"unknown\": %llu }", firstPage ? "" : ",",
+			(unsigned long long)page.start, (unsigned long long)page.end, (unsigned long long)page.count);
+
+		firstPage = false;
+	}
+
+	fprintf(file, "%s] }\n}\n", firstPage ? "" : "\n\t");
+}
+
+struct Options
+{
+	std::string inputPath{ std::string(PROJECT_PATH) + "/DC - BIOS.bin" };
+	uint64_t rangeStart{};
+	uint64_t rangeEnd{ UINT64_MAX };
+	std::string outputPath{ "-" };
+	int threadCount{ 1 };
+	uint32_t base{};
+	bool hasBase{};
+	bool scrambled{};
+	uint64_t addressStart{};
+	uint64_t addressEnd{ UINT64_MAX };
+	std::string function;
+	bool recursive{};
+	bool cycles{};
+	std::string cachePath;
+	std::vector<uint32_t> entries;
+	std::string statsPath;
+	uint32_t runAddress{};
+	bool run{};
+	uint64_t runSteps{ 100'000'000 };
+	std::string xrefsPath;
+	std::vector<uint32_t> refs;
+	bool serve{};
+	std::string diffPaths[2];
+	std::string signaturePath;
+	std::vector<std::string> inputPaths;	// every image named, --find-sig searches all of them
+	bool skipData{};
+	bool binary{};
+	bool annotate{};
+	std::vector<std::string> symbolPaths;
+};
+
+static void printUsage()
+{
+	fprintf(stderr,
+		"usage: decompsh [options] [image]\n"
+		"  -o, --output path   where to write the listing (default '-' for stdout)\n"
+		"  --range start:end   only disassemble file offsets [start, end) of a raw image\n"
+		"  --address start:end only disassemble the addresses [start, end)\n"
+		"  --function name     only disassemble the ELF function 'name'\n"
+		"  --threads N         decode and format on N threads (0 = one per core)\n"
+		"  --base address      address the start of a raw image is loaded at (default 0)\n"
+		"  --scrambled         the image is a scrambled 1ST_READ.BIN, loaded at\n"
+		"                      0x8C010000 unless --base says otherwise\n"
+		"  --recursive         only disassemble code reachable from the entry points\n"
+		"  --entry address     extra entry point for --recursive, the reset vector\n"
+		"                      0xA0000000 and the ELF entry point are used whenever\n"
+		"                      they are inside the image\n"
+		"  --cache path        keep the --recursive analysis in 'path' between runs,\n"
+		"                      an unchanged image isn't decoded or traced again\n"
+		"  --cycles            list every reachable block with its estimated SH4 cycle\n"
+		"                      count instead of disassembling (implies --recursive)\n"
+		"  --stats path        write opcode counts, unknown words per 4KB and phase\n"
+		"                      timings to 'path' as JSON ('-' for stderr)\n"
+		"  --run address       run the code at 'address' before listing, the memory it\n"
+		"                      leaves behind is listed and where its computed jumps\n"
+		"                      went are used as entry points\n"
+		"  --steps N           stop running after N instructions (default 100000000)\n"
+		"  --xrefs path        keep the cross reference index in 'path' between runs\n"
+		"  --refs address      print what references 'address' and what it references\n"
+		"                      instead of the listing, can be given more than once\n"
+		"  --serve             load the image once and answer commands on stdin\n"
+		"                      (list start [end], function address, refs address, quit)\n"
+		"  --diff old new      list the instructions that differ between two images\n"
+		"                      instead of disassembling, --base and --scrambled apply\n"
+		"                      to both\n"
+		"  --find-sig path     print where the signatures in 'path' match instead of\n"
+		"                      disassembling, every image given is searched\n"
+		"  --skip-data         list parts of the image that look like data (compressed\n"
+		"                      or random bytes, padding) as one line instead\n"
+		"  --binary            write the listing as indexed fixed size records (see\n"
+		"                      binary.h) instead of text\n"
+		"  --annotate          name the SH4 and Dreamcast hardware registers that\n"
+		"                      constants, addresses and branch targets point at\n"
+		"  --symbols path      also name the addresses in 'path', one 'address name\n"
+		"                      [size]' per line, can be given more than once\n"
+	);
+}
+
+static bool parseRange(const char* string, uint64_t& start, uint64_t& end)
+{
+	char* separator{};
+	start = strtoull(string, &separator, 0);
+
+	if (*separator != ':')
+		return false;
+
+	end = separator[1] ? strtoull(separator + 1, nullptr, 0) : UINT64_MAX;
+
+	return start < end;
+}
+
+static bool parseOptions(int argc, const char** argv, Options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if ((!strcmp(arg, "-o") || !strcmp(arg, "--output")) && hasValue)
+		{
+			options.outputPath = argv[++i];
+		}
+		else if (!strcmp(arg, "--range") && hasValue)
+		{
+			if (!parseRange(argv[++i], options.rangeStart, options.rangeEnd))
+				return false;
+		}
+		else if (!strcmp(arg, "--threads") && hasValue)
+		{
+			options.threadCount = atoi(argv[++i]);
+
+			if (options.threadCount <= 0)
+				options.threadCount = std::max(1, int(std::thread::hardware_concurrency()));
+		}
+		else if (!strcmp(arg, "--address") && hasValue)
+		{
+			if (!parseRange(argv[++i], options.addressStart, options.addressEnd))
+				return false;
+		}
+		else if (!strcmp(arg, "--function") && hasValue)
+		{
+			options.function = argv[++i];
+		}
+		else if (!strcmp(arg, "--base") && hasValue)
+		{
+			options.base = uint32_t(strtoul(argv[++i], nullptr, 0));
+			options.hasBase = true;
+		}
+		else if (!strcmp(arg, "--scrambled"))
+		{
+			options.scrambled = true;
+		}
+		else if (!strcmp(arg, "--recursive"))
+		{
+			options.recursive = true;
+		}
+		else if (!strcmp(arg, "--cycles"))
+		{
+			options.recursive = true;
+			options.cycles = true;
+		}
+		else if (!strcmp(arg, "--cache") && hasValue)
+		{
+			options.cachePath = argv[++i];
+		}
+		else if (!strcmp(arg, "--entry") && hasValue)
+		{
+			options.entries.push_back(uint32_t(strtoul(argv[++i], nullptr, 0)));
+		}
+		else if (!strcmp(arg, "--stats") && hasValue)
+		{
+			options.statsPath = argv[++i];
+		}
+		else if (!strcmp(arg, "--run") && hasValue)
+		{
+			options.runAddress = uint32_t(strtoul(argv[++i], nullptr, 0));
+			options.run = true;
+		}
+		else if (!strcmp(arg, "--steps") && hasValue)
+		{
+			options.runSteps = strtoull(argv[++i], nullptr, 0);
+		}
+		else if (!strcmp(arg, "--xrefs") && hasValue)
+		{
+			options.xrefsPath = argv[++i];
+		}
+		else if (!strcmp(arg, "--refs") && hasValue)
+		{
+			options.refs.push_back(uint32_t(strtoul(argv[++i], nullptr, 0)));
+		}
+		else if (!strcmp(arg, "--serve"))
+		{
+			options.serve = true;
+		}
+		else if (!strcmp(arg, "--diff") && i + 2 < argc)
+		{
+			options.diffPaths[0] = argv[++i];
+			options.diffPaths[1] = argv[++i];
+		}
+		else if (!strcmp(arg, "--find-sig") && hasValue)
+		{
+			options.signaturePath = argv[++i];
+		}
+		else if (!strcmp(arg, "--skip-data"))
+		{
+			options.skipData = true;
+		}
+		else if (!strcmp(arg, "--binary"))
+		{
+			options.binary = true;
+		}
+		else if (!strcmp(arg, "--annotate"))
+		{
+			options.annotate = true;
+		}
+		else if (!strcmp(arg, "--symbols") && hasValue)
+		{
+			options.symbolPaths.push_back(argv[++i]);
+		}
+		else if (arg[0] == '-' && arg[1])
+		{
+			return false;
+		}
+		else
+		{
+			options.inputPath = arg;
+			options.inputPaths.push_back(arg);
+		}
+	}
+
+	return true;
+}
+
+static const char* getStopName(Interpreter::Stop stop)
+{
+	switch (stop)
+	{
+	case Interpreter::Stop::Steps: return "out of steps";
+	case Interpreter::Stop::Returned: return "returned";
+	case Interpreter::Stop::Unsupported: return "unsupported instruction";
+	case Interpreter::Stop::SlotIllegal: return "branch in a delay slot";
+	case Interpreter::Stop::Fetch: return "no memory to run";
+	case Interpreter::Stop::Sleep: return "sleep";
+	default: return "running";
+	}
+}
+
+// runs the code at 'address' as if it was called and swaps the program's bytes
+// for the memory it leaves behind, so code that decrypts or unpacks itself is
+// listed as it ends up. where the computed jumps went become entry points
+static bool runProgram(Options& options, Program& program)
+{
+	Interpreter interpreter;
+	uint64_t imageSize{};
+
+	for (const auto& segment : program.segments)
+	{
+		std::unique_ptr<MappedFile> mapping;
+		ImageView view;
+
+		if (!mapSegment(program, segment, 0, UINT64_MAX, mapping, view))
+		{
+			fprintf(stderr, "couldn't map '%s'\n", program.path.c_str());
+			return false;
+		}
+
+		interpreter.load(segment.address, view.words.data(), view.words.size() * 2);
+		imageSize = std::max(imageSize, segment.fileOffset + segment.size);
+	}
+
+	// called from nowhere with the stack at the top of the Dreamcast's 16MB of ram
+	interpreter.PC = options.runAddress;
+	interpreter.PR = interpreter.exitAddress = 0xFFFFFFFE;
+	interpreter.R[15] = 0x8D000000;
+
+	const auto start = std::chrono::steady_clock::now();
+	const auto stop = interpreter.run(options.runSteps);
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	fprintf(stderr, "run: %s at 0x%08X after %llu instructions (%.1f MIPS)\n", getStopName(stop), interpreter.PC,
+		(unsigned long long)interpreter.steps, seconds > 0 ? interpreter.steps / seconds / 1e6 : 0.0);
+
+	for (int i = 0; i < 16; i++)
+		fprintf(stderr, "  r%-2d %08X%s", i, interpreter.R[i], i % 4 == 3 ? "\n" : "");
+
+	fprintf(stderr, "  sr  %08X  pr  %08X  gbr %08X  vbr %08X\n", uint32_t(interpreter.SR), interpreter.PR, interpreter.GBR, interpreter.VBR);
+
+	std::vector<uint64_t> jumps(interpreter.indirectJumps.begin(), interpreter.indirectJumps.end());
+	std::sort(jumps.begin(), jumps.end());
+
+	for (const auto jump : jumps)
+	{
+		fprintf(stderr, "  jump at 0x%08X went to 0x%08X\n", uint32_t(jump >> 32), uint32_t(jump));
+		options.entries.push_back(uint32_t(jump));
+	}
+
+	program.image.assign(size_t(imageSize + 1) / 2, 0);
+
+	for (const auto& segment : program.segments)
+		interpreter.save(segment.address, program.image.data() + segment.fileOffset / 2, size_t(segment.size & ~1ull));
+
+	return true;
+}
+
+// builds the cross references of the code in 'view', or loads them from
+// 'path' if they were saved for the same image
+static XrefIndex getXrefs(const ImageView& view, const CodeDataMap& codeData, const std::string& path)
+{
+	XrefIndex current(view, codeData);
+	XrefIndex previous;
+
+	if (!path.empty() && previous.load(path, view) && current.matches(previous))
+		return previous;
+
+	std::vector<DecodedInst> decoded(view.words.size());
+	Decoder::decode(view.words, decoded);
+	current.build(view, decoded, codeData);
+
+	if (!path.empty() && !current.save(path))
+		fprintf(stderr, "couldn't write the cross references '%s'\n", path.c_str());
+
+	return current;
+}
+
+static void appendRefs(OutputWriter& writer, const XrefIndex& index, std::span<const uint32_t> addresses)
+{
+	char line[64]{};
+
+	for (const auto address : addresses)
+	{
+		writer.write(line, snprintf(line, sizeof(line), "refs to 0x%08X:\n", address));
+
+		for (const auto& ref : index.getRefsTo(address))
+			writer.write(line, snprintf(line, sizeof(line), "  0x%08X %s\n", ref.from, getXrefKindName(ref.kind)));
+
+		writer.write(line, snprintf(line, sizeof(line), "refs from 0x%08X:\n", address));
+
+		for (const auto& ref : index.getRefsFrom(address))
+			writer.write(line, snprintf(line, sizeof(line), "  0x%08X %s\n", ref.to, getXrefKindName(ref.kind)));
+	}
+}
+
+// the positions in 'view' that tracing starts from
+static std::vector<uint64_t> getEntries(const Options& options, const Program& program, const ImageView& view)
+{
+	std::vector<uint64_t> entries;
+	uint64_t resetVector{};
+	uint64_t programEntry{};
+
+	if (view.getPosition(0xA0000000, resetVector))
+		entries.push_back(resetVector);
+
+	if (program.hasEntry && view.getPosition(program.entry, programEntry))
+		entries.push_back(programEntry);
+
+	for (auto address : options.entries)
+	{
+		uint64_t position{};
+
+		// with several sections an entry point is only in one of them
+		if (view.getPosition(address, position))
+			entries.push_back(position);
+		else if (program.segments.size() == 1)
+			fprintf(stderr, "entry point 0x%08X is outside the image\n", address);
+	}
+
+	return entries;
+}
+
+// lists one mapped part of the program, returns how long the analysis before
+// the listing took
+static std::chrono::steady_clock::duration listView(const Options& options, const std::string& cachePath, const std::string& xrefsPath, const Program& program, const ImageView& view, OutputWriter& writer, BinaryListingWriter* binary, ListingStats* listingStats, const SymbolIndex* symbols)
+{
+	const auto& words = view.words;
+	std::chrono::steady_clock::duration analyseTime{};
+	const auto analyseStart = std::chrono::steady_clock::now();
+
+	if (options.recursive)
+	{
+		const auto entries = getEntries(options, program, view);
+		const auto graph = cachePath.empty() ?
+			traceFlow(view, decodeView(view), entries) :
+			traceFlowCached(view, entries, cachePath);
+
+		if (options.cycles)
+		{
+			analyseTime = std::chrono::steady_clock::now() - analyseStart;
+			std::vector<DecodedInst> decoded(view.words.size());
+			Decoder::decode(view.words, decoded);
+
+			appendCycleReport(writer, view, decoded, graph);
+		}
+		else
+		{
+			// only loads in code that was actually reached say where the pools are
+			CodeDataMap codeData;
+
+			for (const auto& block : graph.blocks)
+				markLiteralPools(codeData, view, block.start, (block.end - block.start) / 2);
+
+			if (!xrefsPath.empty() || !options.refs.empty())
+			{
+				// words that weren't reached don't reference anything
+				CodeDataMap reached = codeData;
+				reached.dataWords.resize(view.words.size());
+
+				for (size_t i = 0; i < view.words.size(); i++)
+					if (!graph.visited[i])
+						reached.dataWords[i] = true;
+
+				const auto xrefs = getXrefs(view, reached, xrefsPath);
+
+				if (!options.refs.empty())
+				{
+					appendRefs(writer, xrefs, options.refs);
+					return std::chrono::steady_clock::now() - analyseStart;
+				}
+			}
+
+			analyseTime = std::chrono::steady_clock::now() - analyseStart;
+
+			if (binary)
+			{
+				for (const auto& block : graph.blocks)
+				{
+					const bool isFunction = std::binary_search(graph.functions.begin(), graph.functions.end(), block.start);
+					binary->add(view, codeData, block.start, (block.end - block.start) / 2, isFunction ? BinaryRecord::Function : 0);
+				}
+			}
+			else
+			{
+				appendFlowListing(writer, view, codeData, graph, listingStats, symbols);
+			}
+		}
+	}
+	else
+	{
+		CodeDataMap codeData;
+
+		if (options.skipData)
+		{
+			// loads in what looks like data would mark pools that aren't there
+			codeData.dataWindows = classifyWindows(view);
+
+			for (size_t window = 0; window < codeData.dataWindows.size();)
+			{
+				const auto start = window;
+
+				while (window < codeData.dataWindows.size() && !codeData.dataWindows[window])
+					window++;
+
+				if (window > start)
+				{
+					const auto first = start * classifyWindowWords;
+					markLiteralPools(codeData, view, view.offset + first * 2, std::min(window * classifyWindowWords, words.size()) - first);
+				}
+
+				while (window < codeData.dataWindows.size() && codeData.dataWindows[window])
+					window++;
+			}
+		}
+		else
+		{
+			markLiteralPools(codeData, view, view.offset, words.size());
+		}
+
+		if (!xrefsPath.empty() || !options.refs.empty())
+		{
+			const auto xrefs = getXrefs(view, codeData, xrefsPath);
+
+			if (!options.refs.empty())
+			{
+				appendRefs(writer, xrefs, options.refs);
+				return std::chrono::steady_clock::now() - analyseStart;
+			}
+		}
+
+		analyseTime = std::chrono::steady_clock::now() - analyseStart;
+
+		if (binary)
+		{
+			binary->add(view, codeData, view.offset, words.size());
+		}
+		else if (options.threadCount > 1)
+		{
+			disassembleParallel(view, codeData, options.threadCount, writer, listingStats, symbols);
+		}
+		else
+		{
+			for (size_t index = 0; index < words.size(); index += listingChunkWords)
+			{
+				appendListing(writer.getBuffer(), view, codeData, view.offset + index * 2, std::min(listingChunkWords, words.size() - index), listingStats, symbols);
+				writer.commit();
+			}
+		}
+	}
+
+	return analyseTime;
+}
+
+// a mapped part of the program with everything --serve answers from
+struct ServedView
+{
+	std::unique_ptr<MappedFile> mapping;
+	ImageView view;
+	std::vector<uint16_t> opIds;
+	CodeDataMap codeData;
+	XrefIndex xrefs;
+	FlowGraph graph;	// traced from the entry points once at startup
+};
+
+static ServedView* findView(std::vector<ServedView>& views, uint32_t address, uint64_t& position)
+{
+	for (auto& served : views)
+		if (served.view.getPosition(address, position))
+			return &served;
+
+	return nullptr;
+}
+
+// the blocks a function's own branches reach from 'entry', without the ones it calls
+static FlowGraph getFunction(const FlowGraph& graph, uint64_t entry)
+{
+	const auto& blocks = graph.blocks;
+	std::vector<bool> reached(blocks.size());
+	std::stack<size_t> worklist;
+
+	auto visit = [&](uint64_t position)
+	{
+		auto it = std::lower_bound(blocks.begin(), blocks.end(), position, [](const Block& b, uint64_t p) { return b.start < p; });
+
+		if (it != blocks.end() && it->start == position && !reached[it - blocks.begin()])
+		{
+			reached[it - blocks.begin()] = true;
+			worklist.push(size_t(it - blocks.begin()));
+		}
+	};
+
+	visit(entry);
+
+	while (!worklist.empty())
+	{
+		const auto& block = blocks[worklist.top()];
+		worklist.pop();
+
+		for (int i = 0; i < block.successorCount; i++)
+			visit(block.successors[i]);
+	}
+
+	FlowGraph function;
+	function.functions.push_back(entry);
+
+	for (size_t i = 0; i < blocks.size(); i++)
+		if (reached[i])
+			function.blocks.push_back(blocks[i]);
+
+	return function;
+}
+
+// answers one command, returns false for quit
+static bool serveCommand(const char* line, std::vector<ServedView>& views, OutputWriter& writer, const SymbolIndex* symbols)
+{
+	char command[32]{};
+	int length{};
+
+	if (sscanf(line, "%31s%n", command, &length) != 1)
+		return true;
+
+	char* next{};
+	const uint64_t first = strtoull(line + length, &next, 0);
+	const uint64_t second = strtoull(next, nullptr, 0);
+	char text[128]{};
+
+	if (!strcmp(command, "quit"))
+	{
+		return false;
+	}
+	else if (!strcmp(command, "list"))
+	{
+		// addresses [first, second), or one instruction
+		const uint64_t end = second > first ? second : first + 2;
+
+		for (auto& served : views)
+		{
+			const auto& view = served.view;
+			const uint64_t viewStart = view.getAddress(view.offset);
+			const uint64_t start = std::max(first, viewStart);
+			const uint64_t stop = std::min(end, viewStart + view.words.size() * 2);
+
+			if (start < stop)
+			{
+				appendListing(writer.getBuffer(), view, served.codeData, view.offset + ((start - viewStart) & ~1ull), size_t((stop - start + 1) / 2), nullptr, symbols);
+				writer.commit();
+			}
+		}
+	}
+	else if (!strcmp(command, "function"))
+	{
+		uint64_t position{};
+
+		if (auto* served = findView(views, uint32_t(first), position))
+		{
+			// functions reached from the entry points start a block of the
+			// graph traced at startup, anything else is traced on its own
+			const auto& blocks = served->graph.blocks;
+			const auto it = std::lower_bound(blocks.begin(), blocks.end(), position, [](const Block& b, uint64_t p) { return b.start < p; });
+			const bool reached = it != blocks.end() && it->start == position;
+			FlowGraph traced;
+
+			if (!reached)
+			{
+				FlowTracer tracer(served->view, served->opIds);
+				tracer.followCalls = false;
+				tracer.addFunction(position);
+				tracer.trace(position);
+				traced = tracer.finish();
+			}
+
+			const auto function = getFunction(reached ? served->graph : traced, position);
+			CodeDataMap codeData;
+
+			for (const auto& block : function.blocks)
+				markLiteralPools(codeData, served->view, block.start, (block.end - block.start) / 2);
+
+			appendFlowListing(writer, served->view, codeData, function, nullptr, symbols);
+		}
+		else
+		{
+			writer.write(text, snprintf(text, sizeof(text), "error: 0x%08X is outside the image\n", uint32_t(first)));
+		}
+	}
+	else if (!strcmp(command, "refs"))
+	{
+		const auto address = uint32_t(first);
+
+		writer.write(text, snprintf(text, sizeof(text), "refs to 0x%08X:\n", address));
+
+		for (const auto& served : views)
+			for (const auto& ref : served.xrefs.getRefsTo(address))
+				writer.write(text, snprintf(text, sizeof(text), "  0x%08X %s\n", ref.from, getXrefKindName(ref.kind)));
+
+		writer.write(text, snprintf(text, sizeof(text), "refs from 0x%08X:\n", address));
+
+		for (const auto& served : views)
+			for (const auto& ref : served.xrefs.getRefsFrom(address))
+				writer.write(text, snprintf(text, sizeof(text), "  0x%08X %s\n", ref.to, getXrefKindName(ref.kind)));
+	}
+	else
+	{
+		writer.write(text, snprintf(text, sizeof(text), "error: unknown command '%s', try list, function, refs or quit\n", command));
+	}
+
+	return true;
+}
+
+// keeps the program decoded and indexed and answers one command per line on
+// stdin, so tools that ask lots of small questions don't pay for loading and
+// decoding every time. every reply ends with a line holding only '.'
+static int serve(const Options& options, const Program& program, const SymbolIndex* symbols)
+{
+	std::vector<ServedView> views;
+
+	for (size_t index = 0; index < program.segments.size(); index++)
+	{
+		ServedView served;
+
+		if (!mapSegment(program, program.segments[index], 0, UINT64_MAX, served.mapping, served.view))
+			continue;
+
+		const auto& view = served.view;
+		served.opIds = decodeView(view);
+		markLiteralPools(served.codeData, view, view.offset, view.words.size());
+
+		const auto xrefsPath = index && !options.xrefsPath.empty() ? options.xrefsPath + "." + std::to_string(index) : options.xrefsPath;
+		served.xrefs = getXrefs(view, served.codeData, xrefsPath);
+		served.graph = traceFlow(view, served.opIds, getEntries(options, program, view));
+
+		views.push_back(std::move(served));
+	}
+
+	fprintf(stderr, "serving '%s', commands are list start [end], function address, refs address and quit\n", program.path.c_str());
+
+	OutputWriter writer(stdout);
+	char line[1024]{};
+
+	while (fgets(line, sizeof(line), stdin))
+	{
+		const bool more = serveCommand(line, views, writer, symbols);
+
+		writer.write(".\n", 2);
+		writer.flush();
+
+		if (!more)
+			break;
+	}
+
+	return 0;
+}
+
+static constexpr size_t diffContextWords = 4;
+
+// the listing of words [first, last) with 'prefix' in front of every line
+static void appendDiffLines(std::string& out, const ImageView& view, CodeDataMap& codeData, size_t first, size_t last, char prefix)
+{
+	if (first >= last)
+		return;
+
+	std::string text;
+	markLiteralPools(codeData, view, view.offset + first * 2, last - first);
+	appendListing(text, view, codeData, view.offset + first * 2, last - first);
+
+	for (size_t start = 0; start < text.size();)
+	{
+		const auto end = std::min(text.find('\n', start), text.size() - 1);
+
+		out += prefix;
+		out.append(text, start, end - start + 1);
+
+		start = end + 1;
+	}
+}
+
+// compares two whole images and lists every changed run of instructions like a
+// unified diff, with a few unchanged ones either side. only the changes and
+// their context are decoded
+static bool diffImages(const Options& options, OutputWriter& writer)
+{
+	Program programs[2];
+	std::unique_ptr<MappedFile> mappings[2];
+	ImageView views[2];
+
+	for (int side = 0; side < 2; side++)
+	{
+		const auto& path = options.diffPaths[side];
+		auto& program = programs[side];
+
+		if (options.scrambled)
+		{
+			if (!loadScrambled(path, options.hasBase ? options.base : firstReadAddress, program))
+				return false;
+
+			views[side] = { program.image, 0, program.segments[0].address };
+			continue;
+		}
+
+		mappings[side] = std::make_unique<MappedFile>(path);
+
+		if (!mappings[side]->isValid())
+		{
+			fprintf(stderr, "couldn't map '%s'\n", path.c_str());
+			return false;
+		}
+
+		views[side] = { mappings[side]->getWords(), 0, options.base };
+	}
+
+	CodeDataMap codeData[2];
+	const auto changes = diffWords(views[0].words, views[1].words);
+	size_t removed{};
+	size_t added{};
+
+	for (size_t c = 0; c < changes.size(); c++)
+	{
+		const auto& change = changes[c];
+		auto& out = writer.getBuffer();
+
+		// context comes from the new image and stops at the neighbouring changes
+		const size_t previousEnd = c ? changes[c - 1].newEnd : 0;
+		const size_t nextStart = c + 1 < changes.size() ? changes[c + 1].newStart : views[1].words.size();
+		const size_t before = std::max(previousEnd, change.newStart - std::min(change.newStart, diffContextWords));
+		const size_t after = std::min(nextStart, change.newEnd + diffContextWords);
+
+		char header[96]{};
+		out.append(header, snprintf(header, sizeof(header), "@@ 0x%08X,%zu 0x%08X,%zu @@\n",
+			uint32_t(views[0].getAddress(change.oldStart * 2)), change.oldEnd - change.oldStart,
+			uint32_t(views[1].getAddress(change.newStart * 2)), change.newEnd - change.newStart));
+
+		appendDiffLines(out, views[1], codeData[1], before, change.newStart, ' ');
+		appendDiffLines(out, views[0], codeData[0], change.oldStart, change.oldEnd, '-');
+		appendDiffLines(out, views[1], codeData[1], change.newStart, change.newEnd, '+');
+		appendDiffLines(out, views[1], codeData[1], change.newEnd, after, ' ');
+
+		writer.commit();
+
+		removed += change.oldEnd - change.oldStart;
+		added += change.newEnd - change.newStart;
+	}
+
+	fprintf(stderr, "diff: %zu changes, %zu instructions removed and %zu added\n", changes.size(), removed, added);
+	return true;
+}
+
+// the built in names with --annotate, then the symbol files so their names
+// win over built in ones of the same size
+static bool loadSymbols(const Options& options, SymbolIndex& symbols)
+{
+	if (options.annotate)
+		symbols.addBuiltins();
+
+	for (const auto& path : options.symbolPaths)
+		if (!symbols.load(path))
+			return false;
+
+	symbols.build();
+	return true;
+}
+
+// one line per match, 'path: address name', images are mapped one at a time
+static bool findSignatures(const Options& options, OutputWriter& writer)
+{
+	SignatureSet signatures;
+
+	if (!signatures.load(options.signaturePath))
+		return false;
+
+	const auto& paths = options.inputPaths.empty() ? std::vector<std::string>{ options.inputPath } : options.inputPaths;
+	size_t matches{};
+
+	for (const auto& path : paths)
+	{
+		const MappedFile file(path);
+
+		if (!file.isValid())
+		{
+			fprintf(stderr, "couldn't map '%s'\n", path.c_str());
+			continue;
+		}
+
+		const ImageView view{ file.getWords(), 0, options.base };
+
+		signatures.search(view.words, [&](const Signature& signature, size_t index)
+		{
+			char line[512]{};
+			writer.write(line, snprintf(line, sizeof(line), "%s: 0x%08X %s\n", path.c_str(), uint32_t(view.getAddress(index * 2)), signature.name.c_str()));
+			matches++;
+		});
+	}
+
+	fprintf(stderr, "find-sig: %zu signatures, %zu matches in %zu images\n", signatures.signatures.size(), matches, paths.size());
+	return true;
+}
+
+int main(int argc, const char** argv)
+{
+	Options options;
+
+	if (!parseOptions(argc, argv, options))
+	{
+		printUsage();
+		return 1;
+	}
+
+	if (!options.diffPaths[0].empty() || !options.signaturePath.empty())
+	{
+		auto* file = options.outputPath == "-" ? stdout : fopen(options.outputPath.c_str(), "wb");
+
+		if (!file)
+		{
+			fprintf(stderr, "couldn't open '%s' for writing\n", options.outputPath.c_str());
+			return 1;
+		}
+
+		bool ok{};
+
+		{
+			OutputWriter writer(file);
+			ok = options.signaturePath.empty() ? diffImages(options, writer) : findSignatures(options, writer);
+		}
+
+		if (file != stdout)
+			fclose(file);
+
+		return ok ? 0 : 1;
+	}
+
+	const auto startTime = std::chrono::steady_clock::now();
+	Program program;
+
+	if (options.scrambled)
+	{
+		if (!loadScrambled(options.inputPath, options.hasBase ? options.base : firstReadAddress, program))
+			return 1;
+	}
+	else if (isElf(options.inputPath))
+	{
+		if (!loadElf(options.inputPath, program))
+			return 1;
+	}
+	else if (!loadRaw(options.inputPath, options.base, options.rangeStart, options.rangeEnd, program))
+	{
+		return 1;
+	}
+
+	if (!options.function.empty())
+	{
+		uint32_t address{};
+		uint32_t size{};
+
+		if (!findElfFunction(options.inputPath, options.function, address, size))
+		{
+			fprintf(stderr, "couldn't find a function called '%s'\n", options.function.c_str());
+			return 1;
+		}
+
+		options.addressStart = address;
+		options.addressEnd = uint64_t(address) + std::max(size, 2u);
+		options.entries.push_back(address);
+	}
+
+	if (options.run && !runProgram(options, program))
+		return 1;
+
+	SymbolIndex symbolIndex;
+
+	if (!loadSymbols(options, symbolIndex))
+		return 1;
+
+	const auto* symbols = symbolIndex.empty() ? nullptr : &symbolIndex;
+
+	if (options.serve)
+		return serve(options, program, symbols);
+
+	const auto loadTime = std::chrono::steady_clock::now() - startTime;
+
+	const bool toStdout = options.outputPath == "-";
+	auto* file = toStdout ? stdout : fopen(options.outputPath.c_str(), "wb");
+
+	if (!file)
+	{
+		fprintf(stderr, "couldn't open '%s' for writing\n", options.outputPath.c_str());
+		return 1;
+	}
+
+	// the phases are only timed when asked for, the listing doesn't pay for it otherwise
+	ListingStats stats;
+	auto* listingStats = options.statsPath.empty() ? nullptr : &stats;
+	std::chrono::steady_clock::duration analyseTime{};
+	std::chrono::steady_clock::duration writeTime{};
+	uint64_t totalWords{};
+
+	{
+		OutputWriter writer(file);
+		BinaryListingWriter binaryListing;
+		auto* binary = options.binary ? &binaryListing : nullptr;
+
+		for (size_t index = 0; index < program.segments.size(); index++)
+		{
+			const auto& segment = program.segments[index];
+			std::unique_ptr<MappedFile> mapping;
+			ImageView view;
+
+			// only the part of the file that's asked for is ever mapped
+			if (!mapSegment(program, segment, options.addressStart, options.addressEnd, mapping, view))
+				continue;
+
+			if (!segment.name.empty() && !binary)
+			{
+				char header[128]{};
+				writer.write(header, snprintf(header, sizeof(header), "%s; section %s\n", totalWords ? "\n" : "", segment.name.c_str()));
+			}
+
+			const auto cachePath = index && !options.cachePath.empty() ? options.cachePath + "." + std::to_string(index) : options.cachePath;
+			const auto xrefsPath = index && !options.xrefsPath.empty() ? options.xrefsPath + "." + std::to_string(index) : options.xrefsPath;
+			analyseTime += listView(options, cachePath, xrefsPath, program, view, writer, binary, listingStats, symbols);
+			totalWords += view.words.size();
+
+			if (listingStats)
+				stats.collectPages(view);
+		}
+
+		writer.flush();
+		writeTime = writer.getWriteTime();
+
+		if (binary && !binary->write(file))
+		{
+			fprintf(stderr, "couldn't write the binary listing to '%s'\n", options.outputPath.c_str());
+			return 1;
+		}
+	}
+
+	if (!toStdout)
+		fclose(file);
+
+	if (listingStats)
+	{
+		const Phase phases[]
+		{
+			{ "load", loadTime },
+			{ "analyse", analyseTime },
+			{ "decode", stats.decodeTime },
+			{ "format", stats.formatTime },
+			{ "write", writeTime },
+		};
+
+		const auto totalTime = std::chrono::steady_clock::now() - startTime;
+		auto* statsFile = options.statsPath == "-" ? stderr : fopen(options.statsPath.c_str(), "wb");
+
+		if (!statsFile)
+		{
+			fprintf(stderr, "couldn't open '%s' for writing\n", options.statsPath.c_str());
+			return 1;
+		}
+
+		writeStats(statsFile, options.inputPath, totalWords, stats, phases, totalTime);
+
+		if (statsFile != stderr)
+			fclose(statsFile);
+	}
+
+	return 0;
+}
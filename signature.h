@@ -0,0 +1,354 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <span>
+#include <bit>
+#include <algorithm>
+
+#include "decoder.h"
+
+// masked instruction sequences for spotting library functions in an image.
+// a signature file has one signature per line, a name followed by its words:
+//
+//   # comments run to the end of the line
+//   syMalloc  2F86 2F96 D1?? 412B 0009
+//
+// a word matches when (word & mask) == value, the same as decodingMask and op
+// in inst.inl. '?' is a wildcard nibble, 'value/mask' gives the mask bit by
+// bit and '*' matches any word
+struct Signature
+{
+	std::string name;
+	std::vector<uint16_t> values;
+	std::vector<uint16_t> masks;
+	size_t anchor{};	// the first word that isn't all wildcard, what the search looks up
+};
+
+inline bool parseSignatureWord(const char* token, uint16_t& value, uint16_t& mask)
+{
+	value = 0;
+	mask = 0;
+
+	if (!strcmp(token, "*"))
+		return true;
+
+	if (const char* slash = strchr(token, '/'))
+	{
+		char* end{};
+		value = uint16_t(strtoul(token, &end, 16));
+		mask = uint16_t(strtoul(slash + 1, nullptr, 16));
+
+		value &= mask;
+		return end == slash;
+	}
+
+	if (strlen(token) != 4)
+		return false;
+
+	for (int i = 0; i < 4; i++)
+	{
+		const char c = token[i];
+		const int shift = (3 - i) * 4;
+
+		if (c == '?')
+			continue;
+
+		const int digit = c >= '0' && c <= '9' ? c - '0' : c >= 'A' && c <= 'F' ? c - 'A' + 10 : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+
+		if (digit < 0)
+			return false;
+
+		value |= uint16_t(digit << shift);
+		mask |= uint16_t(0xF << shift);
+	}
+
+	return true;
+}
+
+struct SignatureAnchor
+{
+	uint16_t value{};
+	uint16_t mask{};
+
+	bool operator==(const SignatureAnchor&) const = default;
+};
+
+// finds the words of 'words' that some anchor matches, two bits per word in
+// 'hits' (one uint32_t per 16 words) with only the low one of each pair set
+using AnchorKernel = void (*)(std::span<const SignatureAnchor> anchors, const uint64_t* anchorWords, const uint16_t* words, size_t n, uint32_t* hits);
+
+static void findAnchorsScalar(std::span<const SignatureAnchor>, const uint64_t* anchorWords, const uint16_t* words, size_t n, uint32_t* hits)
+{
+	for (size_t group = 0; group * 16 < n; group++)
+	{
+		const size_t count = std::min<size_t>(16, n - group * 16);
+		uint32_t bits = 0;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const uint16_t word = words[group * 16 + i];
+			bits |= uint32_t((anchorWords[word >> 6] >> (word & 63)) & 1) << (i * 2);
+		}
+
+		hits[group] = bits;
+	}
+}
+
+#if DECOMPSH_X86
+// up to this many distinct anchors comparing against each is quicker than the gather
+inline constexpr size_t maxCompareAnchors = 4;
+
+// masks and compares 16 words against every anchor at once
+DECOMPSH_TARGET("avx2") static size_t compareAnchorsAvx2(std::span<const SignatureAnchor> anchors, const uint16_t* words, size_t n, uint32_t* hits)
+{
+	__m256i values[maxCompareAnchors];
+	__m256i masks[maxCompareAnchors];
+
+	for (size_t k = 0; k < anchors.size(); k++)
+	{
+		values[k] = _mm256_set1_epi16(short(anchors[k].value));
+		masks[k] = _mm256_set1_epi16(short(anchors[k].mask));
+	}
+
+	size_t i = 0;
+
+	for (; i + 16 <= n; i += 16)
+	{
+		const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+		__m256i hit = _mm256_setzero_si256();
+
+		for (size_t k = 0; k < anchors.size(); k++)
+			hit = _mm256_or_si256(hit, _mm256_cmpeq_epi16(_mm256_and_si256(w, masks[k]), values[k]));
+
+		hits[i / 16] = uint32_t(_mm256_movemask_epi8(hit)) & 0x55555555;
+	}
+
+	return i;
+}
+
+// looks 16 words up in the anchor bitmap at once, read as 32 bit words (x86 is
+// little endian so bit 'word' is still bit 'word & 31' of dword 'word >> 5').
+// the bit is shifted up to the sign so the saturating pack keeps it in the top
+// byte of each 16 bit lane, which movemask then picks out
+DECOMPSH_TARGET("avx2") static size_t gatherAnchorsAvx2(const uint64_t* anchorWords, const uint16_t* words, size_t n, uint32_t* hits)
+{
+	const auto* table = reinterpret_cast<const int*>(anchorWords);
+	const __m256i bitMask = _mm256_set1_epi32(31);
+	size_t i = 0;
+
+	for (; i + 16 <= n; i += 16)
+	{
+		const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+		const __m256i low = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(w));
+		const __m256i high = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(w, 1));
+
+		__m256i lowBits = _mm256_i32gather_epi32(table, _mm256_srli_epi32(low, 5), 4);
+		__m256i highBits = _mm256_i32gather_epi32(table, _mm256_srli_epi32(high, 5), 4);
+		lowBits = _mm256_sllv_epi32(lowBits, _mm256_andnot_si256(low, bitMask));
+		highBits = _mm256_sllv_epi32(highBits, _mm256_andnot_si256(high, bitMask));
+
+		// the pack interleaves the halves per 128 bit lane, the permute puts them back in order
+		const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lowBits, highBits), 0xD8);
+		hits[i / 16] = (uint32_t(_mm256_movemask_epi8(packed)) >> 1) & 0x55555555;
+	}
+
+	return i;
+}
+
+DECOMPSH_TARGET("avx2") static void findAnchorsAvx2(std::span<const SignatureAnchor> anchors, const uint64_t* anchorWords, const uint16_t* words, size_t n, uint32_t* hits)
+{
+	const size_t i = anchors.size() <= maxCompareAnchors ? compareAnchorsAvx2(anchors, words, n, hits) : gatherAnchorsAvx2(anchorWords, words, n, hits);
+
+	if (i < n)
+		findAnchorsScalar(anchors, anchorWords, words + i, n - i, hits + i / 16);
+}
+#endif
+
+inline AnchorKernel selectAnchorKernel()
+{
+#if DECOMPSH_X86
+	if (getCpuFeatures().avx2)
+		return findAnchorsAvx2;
+#endif
+
+	return findAnchorsScalar;
+}
+
+// the signatures, plus a table over every possible word of the signatures
+// whose anchor it matches, built like the decoder's dispatch table so the
+// search is one lookup per word of the image
+struct SignatureSet
+{
+	std::vector<Signature> signatures;
+	std::vector<SignatureAnchor> anchors;	// the distinct anchor words, compared directly when there are few
+	std::vector<uint64_t> anchorWords;	// one bit per word, set if any anchor matches it
+	std::vector<uint32_t> candidateStart;	// per word, where its signatures start in 'candidates'
+	std::vector<uint32_t> candidates;
+
+	bool load(const std::string& path)
+	{
+		auto* file = fopen(path.c_str(), "rb");
+
+		if (!file)
+		{
+			fprintf(stderr, "couldn't open '%s'\n", path.c_str());
+			return false;
+		}
+
+		char line[4096]{};
+		int lineNumber{};
+		bool ok = true;
+
+		while (ok && fgets(line, sizeof(line), file))
+		{
+			lineNumber++;
+
+			if (char* comment = strchr(line, '#'))
+				*comment = '\0';
+
+			const char* separators = " \t\r\n";
+			char* token = strtok(line, separators);
+
+			if (!token)
+				continue;
+
+			Signature signature;
+			signature.name = token;
+
+			while ((token = strtok(nullptr, separators)))
+			{
+				uint16_t value{};
+				uint16_t mask{};
+
+				if (!parseSignatureWord(token, value, mask))
+				{
+					fprintf(stderr, "%s:%d: '%s' isn't a signature word\n", path.c_str(), lineNumber, token);
+					ok = false;
+					break;
+				}
+
+				signature.values.push_back(value);
+				signature.masks.push_back(mask);
+			}
+
+			while (ok && signature.anchor < signature.masks.size() && !signature.masks[signature.anchor])
+				signature.anchor++;
+
+			if (ok && signature.anchor == signature.masks.size())
+			{
+				fprintf(stderr, "%s:%d: '%s' needs at least one word that isn't a wildcard\n", path.c_str(), lineNumber, signature.name.c_str());
+				ok = false;
+			}
+
+			if (ok)
+				signatures.push_back(std::move(signature));
+		}
+
+		fclose(file);
+
+		if (ok)
+			buildCandidates();
+
+		return ok;
+	}
+
+	// counts per word first, then fills them in, the bits each anchor
+	// doesn't care about are enumerated as subsets of its free bits
+	void buildCandidates()
+	{
+		anchorWords.assign(0x10000 / 64, 0);
+		candidateStart.assign(0x10001, 0);
+
+		auto forEachMatch = [](const Signature& signature, auto&& body)
+		{
+			const uint16_t value = signature.values[signature.anchor];
+			const uint16_t free = uint16_t(~signature.masks[signature.anchor]);
+			uint16_t bits = 0;
+
+			do
+			{
+				body(uint16_t(value | bits));
+				bits = uint16_t((bits - free) & free);
+			}
+			while (bits);
+		};
+
+		anchors.clear();
+
+		for (const auto& signature : signatures)
+		{
+			const SignatureAnchor anchor{ signature.values[signature.anchor], signature.masks[signature.anchor] };
+
+			if (std::find(anchors.begin(), anchors.end(), anchor) == anchors.end())
+				anchors.push_back(anchor);
+
+			forEachMatch(signature, [&](uint16_t word) { candidateStart[word + 1]++; });
+		}
+
+		for (size_t word = 0; word < 0x10000; word++)
+			candidateStart[word + 1] += candidateStart[word];
+
+		candidates.resize(candidateStart.back());
+		auto next = candidateStart;
+
+		for (uint32_t i = 0; i < signatures.size(); i++)
+		{
+			forEachMatch(signatures[i], [&](uint16_t word)
+			{
+				candidates[next[word]++] = i;
+				anchorWords[word >> 6] |= 1ull << (word & 63);
+			});
+		}
+	}
+
+	bool matches(const Signature& signature, std::span<const uint16_t> words, size_t start) const
+	{
+		if (start + signature.values.size() > words.size())
+			return false;
+
+		for (size_t i = 0; i < signature.values.size(); i++)
+			if ((words[start + i] & signature.masks[i]) != signature.values[i])
+				return false;
+
+		return true;
+	}
+
+	// calls found(signature, word index) for every match, in the order they are found
+	template <typename Found>
+	void search(std::span<const uint16_t> words, Found&& found) const
+	{
+		static const auto kernel = selectAnchorKernel();
+
+		constexpr size_t chunkWords = 4096;
+		uint32_t hits[chunkWords / 16];
+
+		for (size_t chunk = 0; chunk < words.size(); chunk += chunkWords)
+		{
+			const size_t count = std::min(chunkWords, words.size() - chunk);
+			kernel(anchors, anchorWords.data(), words.data() + chunk, count, hits);
+
+			// most words aren't the start of anything and never get here
+			for (size_t group = 0; group < (count + 15) / 16; group++)
+			{
+				for (uint32_t bits = hits[group]; bits; bits &= bits - 1)
+				{
+					const size_t i = chunk + group * 16 + std::countr_zero(bits) / 2;
+					const uint16_t word = words[i];
+
+					for (uint32_t c = candidateStart[word]; c < candidateStart[word + 1]; c++)
+					{
+						const auto& signature = signatures[candidates[c]];
+
+						if (i >= signature.anchor && matches(signature, words, i - signature.anchor))
+							found(signature, i - signature.anchor);
+					}
+				}
+			}
+		}
+	}
+};
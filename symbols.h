@@ -0,0 +1,562 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <queue>
+#include <algorithm>
+
+// names for addresses, the SH4's on-chip registers and the Dreamcast's
+// hardware plus whatever symbol files are given. they can nest (a register
+// inside its block inside a memory area), so they are flattened into sorted
+// intervals that don't overlap, each named after the smallest symbol covering
+// it. a lookup goes to the 64KB page first and only searches the intervals in
+// it, most branch targets land on pages without any and stop there
+//
+// a symbol file has one symbol per line, its address, name and an optional
+// size in bytes. without a size only the address itself gets the name:
+//
+//   # comments run to the end of the line
+//   0x8C010000 main
+//   0x8C0A0000 fontTable 0x2000
+
+// P1 and P2 are windows onto the same physical addresses (and so is P0 without
+// the MMU), so symbols are matched on that. P4 is kept as is and area 7 is
+// taken as the mirror of the registers in it
+inline uint32_t getSymbolAddress(uint32_t address)
+{
+	if (address >= 0xE0000000)
+		return address;
+
+	const uint32_t physical = address & 0x1FFFFFFF;
+	return physical >= 0x1C000000 ? physical | 0xE0000000 : physical;
+}
+
+struct BuiltinSymbol
+{
+	uint32_t address{};
+	uint32_t size{};
+	const char* name{};
+};
+
+// the registers are from the SH7750 hardware manual and the Dreamcast's are
+// where emulators and KallistiOS agree. ram and the bios are left out, almost
+// every constant would point into one of them
+inline constexpr BuiltinSymbol builtinSymbols[]
+{
+	// SH4 store queues and cache/TLB arrays
+	{ 0xE0000000, 0x04000000, "SQ" },
+	{ 0xF0000000, 0x01000000, "IC_ADDRESS" },
+	{ 0xF1000000, 0x01000000, "IC_DATA" },
+	{ 0xF2000000, 0x01000000, "ITLB_ADDRESS" },
+	{ 0xF3000000, 0x01000000, "ITLB_DATA" },
+	{ 0xF4000000, 0x01000000, "OC_ADDRESS" },
+	{ 0xF5000000, 0x01000000, "OC_DATA" },
+	{ 0xF6000000, 0x01000000, "UTLB_ADDRESS" },
+	{ 0xF7000000, 0x01000000, "UTLB_DATA" },
+
+	// CCN
+	{ 0xFF000000, 4, "PTEH" },
+	{ 0xFF000004, 4, "PTEL" },
+	{ 0xFF000008, 4, "TTB" },
+	{ 0xFF00000C, 4, "TEA" },
+	{ 0xFF000010, 4, "MMUCR" },
+	{ 0xFF000014, 1, "BASRA" },
+	{ 0xFF000018, 1, "BASRB" },
+	{ 0xFF00001C, 4, "CCR" },
+	{ 0xFF000020, 4, "TRA" },
+	{ 0xFF000024, 4, "EXPEVT" },
+	{ 0xFF000028, 4, "INTEVT" },
+	{ 0xFF000034, 4, "PTEA" },
+	{ 0xFF000038, 4, "QACR0" },
+	{ 0xFF00003C, 4, "QACR1" },
+
+	// UBC
+	{ 0xFF200000, 4, "BARA" },
+	{ 0xFF200004, 1, "BAMRA" },
+	{ 0xFF200008, 2, "BBRA" },
+	{ 0xFF20000C, 4, "BARB" },
+	{ 0xFF200010, 1, "BAMRB" },
+	{ 0xFF200014, 2, "BBRB" },
+	{ 0xFF200018, 4, "BDRB" },
+	{ 0xFF20001C, 4, "BDMRB" },
+	{ 0xFF200020, 2, "BRCR" },
+
+	// BSC
+	{ 0xFF800000, 4, "BCR1" },
+	{ 0xFF800004, 2, "BCR2" },
+	{ 0xFF800008, 4, "WCR1" },
+	{ 0xFF80000C, 4, "WCR2" },
+	{ 0xFF800010, 4, "WCR3" },
+	{ 0xFF800014, 4, "MCR" },
+	{ 0xFF800018, 2, "PCR" },
+	{ 0xFF80001C, 2, "RTCSR" },
+	{ 0xFF800020, 2, "RTCNT" },
+	{ 0xFF800024, 2, "RTCOR" },
+	{ 0xFF800028, 2, "RFCR" },
+	{ 0xFF80002C, 4, "PCTRA" },
+	{ 0xFF800030, 2, "PDTRA" },
+	{ 0xFF800040, 4, "PCTRB" },
+	{ 0xFF800044, 2, "PDTRB" },
+	{ 0xFF800048, 2, "GPIOIC" },
+	{ 0xFF900000, 0x10000, "SDMR2" },
+	{ 0xFF940000, 0x10000, "SDMR3" },
+
+	// DMAC
+	{ 0xFFA00000, 4, "SAR0" },
+	{ 0xFFA00004, 4, "DAR0" },
+	{ 0xFFA00008, 4, "DMATCR0" },
+	{ 0xFFA0000C, 4, "CHCR0" },
+	{ 0xFFA00010, 4, "SAR1" },
+	{ 0xFFA00014, 4, "DAR1" },
+	{ 0xFFA00018, 4, "DMATCR1" },
+	{ 0xFFA0001C, 4, "CHCR1" },
+	{ 0xFFA00020, 4, "SAR2" },
+	{ 0xFFA00024, 4, "DAR2" },
+	{ 0xFFA00028, 4, "DMATCR2" },
+	{ 0xFFA0002C, 4, "CHCR2" },
+	{ 0xFFA00030, 4, "SAR3" },
+	{ 0xFFA00034, 4, "DAR3" },
+	{ 0xFFA00038, 4, "DMATCR3" },
+	{ 0xFFA0003C, 4, "CHCR3" },
+	{ 0xFFA00040, 4, "DMAOR" },
+
+	// CPG
+	{ 0xFFC00000, 2, "FRQCR" },
+	{ 0xFFC00004, 1, "STBCR" },
+	{ 0xFFC00008, 2, "WTCNT" },
+	{ 0xFFC0000C, 2, "WTCSR" },
+	{ 0xFFC00010, 1, "STBCR2" },
+
+	// RTC
+	{ 0xFFC80000, 1, "R64CNT" },
+	{ 0xFFC80004, 1, "RSECCNT" },
+	{ 0xFFC80008, 1, "RMINCNT" },
+	{ 0xFFC8000C, 1, "RHRCNT" },
+	{ 0xFFC80010, 1, "RWKCNT" },
+	{ 0xFFC80014, 1, "RDAYCNT" },
+	{ 0xFFC80018, 1, "RMONCNT" },
+	{ 0xFFC8001C, 2, "RYRCNT" },
+	{ 0xFFC80020, 1, "RSECAR" },
+	{ 0xFFC80024, 1, "RMINAR" },
+	{ 0xFFC80028, 1, "RHRAR" },
+	{ 0xFFC8002C, 1, "RWKAR" },
+	{ 0xFFC80030, 1, "RDAYAR" },
+	{ 0xFFC80034, 1, "RMONAR" },
+	{ 0xFFC80038, 1, "RCR1" },
+	{ 0xFFC8003C, 1, "RCR2" },
+
+	// INTC
+	{ 0xFFD00000, 2, "ICR" },
+	{ 0xFFD00004, 2, "IPRA" },
+	{ 0xFFD00008, 2, "IPRB" },
+	{ 0xFFD0000C, 2, "IPRC" },
+
+	// TMU
+	{ 0xFFD80000, 1, "TOCR" },
+	{ 0xFFD80004, 1, "TSTR" },
+	{ 0xFFD80008, 4, "TCOR0" },
+	{ 0xFFD8000C, 4, "TCNT0" },
+	{ 0xFFD80010, 2, "TCR0" },
+	{ 0xFFD80014, 4, "TCOR1" },
+	{ 0xFFD80018, 4, "TCNT1" },
+	{ 0xFFD8001C, 2, "TCR1" },
+	{ 0xFFD80020, 4, "TCOR2" },
+	{ 0xFFD80024, 4, "TCNT2" },
+	{ 0xFFD80028, 2, "TCR2" },
+	{ 0xFFD8002C, 4, "TCPR2" },
+
+	// SCI
+	{ 0xFFE00000, 1, "SCSMR1" },
+	{ 0xFFE00004, 1, "SCBRR1" },
+	{ 0xFFE00008, 1, "SCSCR1" },
+	{ 0xFFE0000C, 1, "SCTDR1" },
+	{ 0xFFE00010, 1, "SCSSR1" },
+	{ 0xFFE00014, 1, "SCRDR1" },
+	{ 0xFFE00018, 1, "SCSCMR1" },
+	{ 0xFFE0001C, 1, "SCSPTR1" },
+
+	// SCIF
+	{ 0xFFE80000, 2, "SCSMR2" },
+	{ 0xFFE80004, 1, "SCBRR2" },
+	{ 0xFFE80008, 2, "SCSCR2" },
+	{ 0xFFE8000C, 1, "SCFTDR2" },
+	{ 0xFFE80010, 2, "SCFSR2" },
+	{ 0xFFE80014, 1, "SCFRDR2" },
+	{ 0xFFE80018, 2, "SCFCR2" },
+	{ 0xFFE8001C, 2, "SCFDR2" },
+	{ 0xFFE80020, 2, "SCSPTR2" },
+	{ 0xFFE80024, 2, "SCLSR2" },
+
+	// Holly system block
+	{ 0xA05F6800, 0x800, "SB" },
+	{ 0xA05F6800, 4, "SB_C2DSTAT" },
+	{ 0xA05F6804, 4, "SB_C2DLEN" },
+	{ 0xA05F6808, 4, "SB_C2DST" },
+	{ 0xA05F6810, 4, "SB_SDSTAW" },
+	{ 0xA05F6814, 4, "SB_SDBAAW" },
+	{ 0xA05F6818, 4, "SB_SDWLT" },
+	{ 0xA05F681C, 4, "SB_SDLAS" },
+	{ 0xA05F6820, 4, "SB_SDST" },
+	{ 0xA05F6840, 4, "SB_DBREQM" },
+	{ 0xA05F6844, 4, "SB_BAVLWC" },
+	{ 0xA05F6848, 4, "SB_C2DPRYC" },
+	{ 0xA05F684C, 4, "SB_C2DMAXL" },
+	{ 0xA05F6880, 4, "SB_TFREM" },
+	{ 0xA05F6884, 4, "SB_LMMODE0" },
+	{ 0xA05F6888, 4, "SB_LMMODE1" },
+	{ 0xA05F688C, 4, "SB_FFST" },
+	{ 0xA05F6890, 4, "SB_SFRES" },
+	{ 0xA05F689C, 4, "SB_SBREV" },
+	{ 0xA05F68A0, 4, "SB_RBSPLT" },
+	{ 0xA05F6900, 4, "SB_ISTNRM" },
+	{ 0xA05F6904, 4, "SB_ISTEXT" },
+	{ 0xA05F6908, 4, "SB_ISTERR" },
+	{ 0xA05F6910, 4, "SB_IML2NRM" },
+	{ 0xA05F6914, 4, "SB_IML2EXT" },
+	{ 0xA05F6918, 4, "SB_IML2ERR" },
+	{ 0xA05F6920, 4, "SB_IML4NRM" },
+	{ 0xA05F6924, 4, "SB_IML4EXT" },
+	{ 0xA05F6928, 4, "SB_IML4ERR" },
+	{ 0xA05F6930, 4, "SB_IML6NRM" },
+	{ 0xA05F6934, 4, "SB_IML6EXT" },
+	{ 0xA05F6938, 4, "SB_IML6ERR" },
+	{ 0xA05F6940, 4, "SB_PDTNRM" },
+	{ 0xA05F6944, 4, "SB_PDTEXT" },
+	{ 0xA05F6950, 4, "SB_G2DTNRM" },
+	{ 0xA05F6954, 4, "SB_G2DTEXT" },
+	{ 0xA05F6C04, 4, "SB_MDSTAR" },
+	{ 0xA05F6C10, 4, "SB_MDTSEL" },
+	{ 0xA05F6C14, 4, "SB_MDEN" },
+	{ 0xA05F6C18, 4, "SB_MDST" },
+	{ 0xA05F6C80, 4, "SB_MSYS" },
+	{ 0xA05F6C84, 4, "SB_MST" },
+	{ 0xA05F6C88, 4, "SB_MSHTCL" },
+	{ 0xA05F6C8C, 4, "SB_MDAPRO" },
+	{ 0xA05F6CE8, 4, "SB_MMSEL" },
+
+	// GD-ROM, its ATA registers and the G1 bus
+	{ 0xA05F7000, 0x400, "G1" },
+	{ 0xA05F7018, 4, "GD_ALTSTAT" },
+	{ 0xA05F7080, 4, "GD_DATA" },
+	{ 0xA05F7084, 4, "GD_ERROR" },
+	{ 0xA05F7088, 4, "GD_INTREASON" },
+	{ 0xA05F708C, 4, "GD_SECTNUM" },
+	{ 0xA05F7090, 4, "GD_BYCTLLO" },
+	{ 0xA05F7094, 4, "GD_BYCTLHI" },
+	{ 0xA05F7098, 4, "GD_DRVSEL" },
+	{ 0xA05F709C, 4, "GD_STATUS" },
+	{ 0xA05F7404, 4, "SB_GDSTAR" },
+	{ 0xA05F7408, 4, "SB_GDLEN" },
+	{ 0xA05F740C, 4, "SB_GDDIR" },
+	{ 0xA05F7414, 4, "SB_GDEN" },
+	{ 0xA05F7418, 4, "SB_GDST" },
+	{ 0xA05F7480, 4, "SB_G1RRC" },
+	{ 0xA05F7484, 4, "SB_G1RWC" },
+	{ 0xA05F7488, 4, "SB_G1FRC" },
+	{ 0xA05F748C, 4, "SB_G1FWC" },
+	{ 0xA05F7490, 4, "SB_G1CRC" },
+	{ 0xA05F7494, 4, "SB_G1CWC" },
+	{ 0xA05F74A0, 4, "SB_G1GDRC" },
+	{ 0xA05F74A4, 4, "SB_G1GDWC" },
+	{ 0xA05F74B0, 4, "SB_G1SYSM" },
+	{ 0xA05F74B4, 4, "SB_G1CRDYC" },
+	{ 0xA05F74B8, 4, "SB_GDAPRO" },
+	{ 0xA05F74F4, 4, "SB_GDSTARD" },
+	{ 0xA05F74F8, 4, "SB_GDLEND" },
+
+	// G2 DMA (AICA and expansion) and PVR DMA
+	{ 0xA05F7800, 0x400, "G2" },
+	{ 0xA05F7800, 4, "SB_ADSTAG" },
+	{ 0xA05F7804, 4, "SB_ADSTAR" },
+	{ 0xA05F7808, 4, "SB_ADLEN" },
+	{ 0xA05F780C, 4, "SB_ADDIR" },
+	{ 0xA05F7810, 4, "SB_ADTSEL" },
+	{ 0xA05F7814, 4, "SB_ADEN" },
+	{ 0xA05F7818, 4, "SB_ADST" },
+	{ 0xA05F781C, 4, "SB_ADSUSP" },
+	{ 0xA05F7890, 4, "SB_G2ID" },
+	{ 0xA05F78BC, 4, "SB_G2APRO" },
+	{ 0xA05F7C00, 0x400, "PVR_DMA" },
+	{ 0xA05F7C00, 4, "SB_PDSTAP" },
+	{ 0xA05F7C04, 4, "SB_PDSTAR" },
+	{ 0xA05F7C08, 4, "SB_PDLEN" },
+	{ 0xA05F7C0C, 4, "SB_PDDIR" },
+	{ 0xA05F7C10, 4, "SB_PDTSEL" },
+	{ 0xA05F7C14, 4, "SB_PDEN" },
+	{ 0xA05F7C18, 4, "SB_PDST" },
+	{ 0xA05F7C80, 4, "SB_PDAPRO" },
+
+	// PowerVR
+	{ 0xA05F8000, 0x2000, "PVR" },
+	{ 0xA05F8000, 4, "PVR_ID" },
+	{ 0xA05F8004, 4, "PVR_REVISION" },
+	{ 0xA05F8008, 4, "SOFTRESET" },
+	{ 0xA05F8014, 4, "STARTRENDER" },
+	{ 0xA05F8018, 4, "TEST_SELECT" },
+	{ 0xA05F8020, 4, "PARAM_BASE" },
+	{ 0xA05F802C, 4, "REGION_BASE" },
+	{ 0xA05F8030, 4, "SPAN_SORT_CFG" },
+	{ 0xA05F8040, 4, "VO_BORDER_COL" },
+	{ 0xA05F8044, 4, "FB_R_CTRL" },
+	{ 0xA05F8048, 4, "FB_W_CTRL" },
+	{ 0xA05F804C, 4, "FB_W_LINESTRIDE" },
+	{ 0xA05F8050, 4, "FB_R_SOF1" },
+	{ 0xA05F8054, 4, "FB_R_SOF2" },
+	{ 0xA05F805C, 4, "FB_R_SIZE" },
+	{ 0xA05F8060, 4, "FB_W_SOF1" },
+	{ 0xA05F8064, 4, "FB_W_SOF2" },
+	{ 0xA05F8068, 4, "FB_X_CLIP" },
+	{ 0xA05F806C, 4, "FB_Y_CLIP" },
+	{ 0xA05F8074, 4, "FPU_SHAD_SCALE" },
+	{ 0xA05F8078, 4, "FPU_CULL_VAL" },
+	{ 0xA05F807C, 4, "FPU_PARAM_CFG" },
+	{ 0xA05F8080, 4, "HALF_OFFSET" },
+	{ 0xA05F8084, 4, "FPU_PERP_VAL" },
+	{ 0xA05F8088, 4, "ISP_BACKGND_D" },
+	{ 0xA05F808C, 4, "ISP_BACKGND_T" },
+	{ 0xA05F8098, 4, "ISP_FEED_CFG" },
+	{ 0xA05F80A0, 4, "SDRAM_REFRESH" },
+	{ 0xA05F80A4, 4, "SDRAM_ARB_CFG" },
+	{ 0xA05F80A8, 4, "SDRAM_CFG" },
+	{ 0xA05F80B0, 4, "FOG_COL_RAM" },
+	{ 0xA05F80B4, 4, "FOG_COL_VERT" },
+	{ 0xA05F80B8, 4, "FOG_DENSITY" },
+	{ 0xA05F80BC, 4, "FOG_CLAMP_MAX" },
+	{ 0xA05F80C0, 4, "FOG_CLAMP_MIN" },
+	{ 0xA05F80C4, 4, "SPG_TRIGGER_POS" },
+	{ 0xA05F80C8, 4, "SPG_HBLANK_INT" },
+	{ 0xA05F80CC, 4, "SPG_VBLANK_INT" },
+	{ 0xA05F80D0, 4, "SPG_CONTROL" },
+	{ 0xA05F80D4, 4, "SPG_HBLANK" },
+	{ 0xA05F80D8, 4, "SPG_LOAD" },
+	{ 0xA05F80DC, 4, "SPG_VBLANK" },
+	{ 0xA05F80E0, 4, "SPG_WIDTH" },
+	{ 0xA05F80E4, 4, "TEXT_CONTROL" },
+	{ 0xA05F80E8, 4, "VO_CONTROL" },
+	{ 0xA05F80EC, 4, "VO_STARTX" },
+	{ 0xA05F80F0, 4, "VO_STARTY" },
+	{ 0xA05F80F4, 4, "SCALER_CTL" },
+	{ 0xA05F8108, 4, "PAL_RAM_CTRL" },
+	{ 0xA05F810C, 4, "SPG_STATUS" },
+	{ 0xA05F8110, 4, "FB_BURSTCTRL" },
+	{ 0xA05F8114, 4, "FB_C_SOF" },
+	{ 0xA05F8118, 4, "Y_COEFF" },
+	{ 0xA05F811C, 4, "PT_ALPHA_REF" },
+	{ 0xA05F8124, 4, "TA_OL_BASE" },
+	{ 0xA05F8128, 4, "TA_ISP_BASE" },
+	{ 0xA05F812C, 4, "TA_OL_LIMIT" },
+	{ 0xA05F8130, 4, "TA_ISP_LIMIT" },
+	{ 0xA05F8134, 4, "TA_NEXT_OPB" },
+	{ 0xA05F8138, 4, "TA_ISP_CURRENT" },
+	{ 0xA05F813C, 4, "TA_GLOB_TILE_CLIP" },
+	{ 0xA05F8140, 4, "TA_ALLOC_CTRL" },
+	{ 0xA05F8144, 4, "TA_LIST_INIT" },
+	{ 0xA05F8148, 4, "TA_YUV_TEX_BASE" },
+	{ 0xA05F814C, 4, "TA_YUV_TEX_CTRL" },
+	{ 0xA05F8150, 4, "TA_YUV_TEX_CNT" },
+	{ 0xA05F8160, 4, "TA_LIST_CONT" },
+	{ 0xA05F8164, 4, "TA_NEXT_OPB_INIT" },
+	{ 0xA05F8200, 0x200, "FOG_TABLE" },
+	{ 0xA05F8600, 0x100, "TA_OL_POINTERS" },
+	{ 0xA05F9000, 0x1000, "PALETTE_RAM" },
+
+	// the rest of the address map
+	{ 0xA0600000, 0x100000, "MODEM" },
+	{ 0xA0700000, 0x10000, "AICA" },
+	{ 0xA0710000, 0x10000, "AICA_RTC" },
+	{ 0xA0800000, 0x200000, "AICA_RAM" },
+	{ 0xA4000000, 0x01000000, "VRAM64" },
+	{ 0xA5000000, 0x01000000, "VRAM32" },
+	{ 0xB0000000, 0x00800000, "TA_FIFO_POLYGON" },
+	{ 0xB0800000, 0x00800000, "TA_FIFO_YUV" },
+	{ 0xB1000000, 0x01000000, "TA_FIFO_TEXTURE" },
+};
+
+// names longer than this are cut so a listing line always has room for one
+inline constexpr size_t maxSymbolName = 128;
+
+struct SymbolIndex
+{
+	struct Symbol
+	{
+		uint32_t start{};	// after getSymbolAddress()
+		uint32_t last{};	// inclusive so a symbol can end at the top of memory
+		std::string name;
+	};
+
+	// what lookups search, sorted by start and never overlapping
+	struct Interval
+	{
+		uint32_t start{};
+		uint32_t last{};
+		uint32_t symbol{};
+	};
+
+	static constexpr uint32_t pageBits = 16;
+
+	std::vector<Symbol> symbols;
+	std::vector<Interval> intervals;
+	std::vector<uint32_t> pages;	// the first interval that ends in or after each page, plus one for the end
+
+	bool empty() const
+	{
+		return symbols.empty();
+	}
+
+	void add(uint32_t address, uint32_t size, const std::string& name)
+	{
+		const uint32_t start = getSymbolAddress(address);
+		const uint32_t last = start + std::min(std::max(size, 1u), UINT32_MAX - start + 1) - 1;
+
+		symbols.push_back({ start, last, name.substr(0, maxSymbolName) });
+	}
+
+	void addBuiltins()
+	{
+		for (const auto& symbol : builtinSymbols)
+			add(symbol.address, symbol.size, symbol.name);
+	}
+
+	bool load(const std::string& path)
+	{
+		auto* file = fopen(path.c_str(), "rb");
+
+		if (!file)
+		{
+			fprintf(stderr, "couldn't open '%s'\n", path.c_str());
+			return false;
+		}
+
+		char line[1024]{};
+		int lineNumber{};
+		bool ok = true;
+
+		while (ok && fgets(line, sizeof(line), file))
+		{
+			lineNumber++;
+
+			if (char* comment = strchr(line, '#'))
+				*comment = '\0';
+
+			const char* separators = " \t\r\n";
+			const char* address = strtok(line, separators);
+
+			if (!address)
+				continue;
+
+			const char* name = strtok(nullptr, separators);
+			const char* size = strtok(nullptr, separators);
+			char* end{};
+			const uint32_t value = uint32_t(strtoul(address, &end, 0));
+
+			if (*end || !name)
+			{
+				fprintf(stderr, "%s:%d: expected an address and a name\n", path.c_str(), lineNumber);
+				ok = false;
+				break;
+			}
+
+			add(value, size ? uint32_t(strtoul(size, nullptr, 0)) : 1, name);
+		}
+
+		fclose(file);
+		return ok;
+	}
+
+	// sweeps the starts and ends in order keeping the symbols that are open,
+	// the smallest one names everything up to the next start or end. the same
+	// size goes to whichever was added last, so files can rename built ins
+	void build()
+	{
+		std::vector<uint32_t> order(symbols.size());
+		for (uint32_t i = 0; i < order.size(); i++)
+			order[i] = i;
+
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return symbols[a].start < symbols[b].start; });
+
+		std::vector<uint64_t> points;
+		points.reserve(symbols.size() * 2);
+
+		for (const auto& symbol : symbols)
+		{
+			points.push_back(symbol.start);
+			points.push_back(uint64_t(symbol.last) + 1);
+		}
+
+		std::sort(points.begin(), points.end());
+		points.erase(std::unique(points.begin(), points.end()), points.end());
+
+		auto smaller = [&](uint32_t a, uint32_t b)
+		{
+			const auto sizeA = symbols[a].last - symbols[a].start;
+			const auto sizeB = symbols[b].last - symbols[b].start;
+			return sizeA != sizeB ? sizeA > sizeB : a < b;
+		};
+
+		std::priority_queue<uint32_t, std::vector<uint32_t>, decltype(smaller)> open(smaller);
+		size_t next{};
+
+		intervals.clear();
+
+		for (size_t p = 0; p + 1 < points.size(); p++)
+		{
+			while (next < order.size() && symbols[order[next]].start == points[p])
+				open.push(order[next++]);
+
+			// ended ones only matter once they are the smallest
+			while (!open.empty() && uint64_t(symbols[open.top()].last) < points[p])
+				open.pop();
+
+			if (open.empty())
+				continue;
+
+			const uint32_t symbol = open.top();
+			const auto last = uint32_t(points[p + 1] - 1);
+
+			if (!intervals.empty() && intervals.back().symbol == symbol && uint64_t(intervals.back().last) + 1 == points[p])
+				intervals.back().last = last;
+			else
+				intervals.push_back({ uint32_t(points[p]), last, symbol });
+		}
+
+		pages.assign((size_t(1) << (32 - pageBits)) + 1, uint32_t(intervals.size()));
+		size_t interval{};
+
+		for (size_t page = 0; page + 1 < pages.size(); page++)
+		{
+			while (interval < intervals.size() && intervals[interval].last < (uint64_t(page) << pageBits))
+				interval++;
+
+			pages[page] = uint32_t(interval);
+		}
+	}
+
+	// the symbol 'address' is in, or nullptr
+	const Symbol* find(uint32_t address, uint32_t& offset) const
+	{
+		const uint32_t key = getSymbolAddress(address);
+		const uint32_t page = key >> pageBits;
+
+		// the interval holding 'key' ends on this page or later and starts no
+		// later than the first one that ends after it
+		const auto begin = intervals.begin() + pages[page];
+		const auto end = intervals.begin() + std::min<size_t>(pages[page + 1] + 1, intervals.size());
+
+		if (begin == end || begin->start > key)
+			return nullptr;
+
+		auto it = std::upper_bound(begin, end, key, [](uint32_t a, const Interval& i) { return a < i.start; });
+
+		if ((--it)->last < key)
+			return nullptr;
+
+		const auto& symbol = symbols[it->symbol];
+		offset = key - symbol.start;
+
+		return &symbol;
+	}
+};
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <span>
+#include <algorithm>
+
+#include "image.h"
+#include "decoder.h"
+#include "cycles.h"
+#include "loader.h"
+
+// every address an instruction points at, found in one linear pass over the
+// decoded image. kept twice, sorted by where the reference is and by what it
+// points at, so both directions are a binary search
+
+enum class XrefKind : uint8_t
+{
+	Branch,		// bra, bt, bf and the delayed ones
+	Call,		// bsr, or jsr/bsrf through a register loaded from a literal pool
+	Jump,		// jmp/braf through a register loaded from a literal pool
+	Read,		// the literal pool slot a pc relative load reads
+	Constant,	// the value a pc relative load puts in its register
+	Address,	// what mova computes
+};
+
+struct Xref
+{
+	uint32_t from{};
+	uint32_t to{};
+	XrefKind kind{};
+};
+
+inline const char* getXrefKindName(XrefKind kind)
+{
+	switch (kind)
+	{
+	case XrefKind::Branch: return "branch";
+	case XrefKind::Call: return "call";
+	case XrefKind::Jump: return "jump";
+	case XrefKind::Read: return "read";
+	case XrefKind::Constant: return "constant";
+	case XrefKind::Address: return "address";
+	}
+
+	return "?";
+}
+
+struct XrefIndex
+{
+	// a branch or call, then a literal pool read and the constant it loads
+	static constexpr uint64_t maxRefsPerWord = 3;
+
+	struct Header
+	{
+		char magic[4]{ 'D', 'S', 'H', 'X' };
+		uint32_t formatVersion{ 1 };
+		uint64_t decoderVersion{};
+		uint64_t imageHash{};
+		uint64_t offset{};
+		uint64_t wordCount{};
+		uint32_t base{};
+		uint32_t padding{};
+		uint64_t count{};
+	};
+
+	Header header;
+	std::vector<Xref> byFrom;
+	std::vector<Xref> byTo;
+
+	XrefIndex() = default;
+
+	// which words are data changes the references too, so it's part of the hash
+	XrefIndex(const ImageView& view, const CodeDataMap& codeData)
+	{
+		header.decoderVersion = decoderVersion;
+		header.imageHash = hashBytes(view.words.data(), view.words.size() * 2);
+
+		for (size_t i = 0; i < codeData.dataWords.size(); i++)
+			if (codeData.dataWords[i])
+				header.imageHash = hashBytes(&i, sizeof(i), header.imageHash);
+
+		header.offset = view.offset;
+		header.wordCount = view.words.size();
+		header.base = view.base;
+	}
+
+	// whether this was built from the same words by the same decoder
+	bool matches(const XrefIndex& other) const
+	{
+		return header.decoderVersion == other.header.decoderVersion &&
+			header.imageHash == other.header.imageHash &&
+			header.offset == other.header.offset &&
+			header.wordCount == other.header.wordCount &&
+			header.base == other.header.base;
+	}
+
+	// words marked as data in 'codeData' are skipped. registers loaded from a
+	// literal pool are followed until something else writes them or the flow
+	// leaves, which is enough for the usual mov.l @(disp,PC),rN; jsr @rN
+	void build(const ImageView& view, std::span<const DecodedInst> decoded, const CodeDataMap& codeData)
+	{
+		uint32_t known{};	// one bit per register holding a literal
+		uint32_t values[16]{};
+
+		byFrom.clear();
+
+		for (size_t i = 0; i < decoded.size(); i++)
+		{
+			const auto inst = decoded[i];
+
+			if (codeData.isData(i))
+			{
+				known = 0;
+				continue;
+			}
+
+			const auto word = view.words[i];
+			const uint32_t address = uint32_t(view.getAddress(view.offset + i * 2));
+			const auto flow = instructionFlows[inst.id];
+			const auto literal = instructionLiterals[inst.id];
+
+			switch (flow)
+			{
+			case Flow::Branch:
+			case Flow::CondBranch:
+			case Flow::CondBranchDelayed:
+				byFrom.push_back({ address, uint32_t(getBranchTarget(flow, word, address)), XrefKind::Branch });
+				break;
+
+			case Flow::Call:
+				byFrom.push_back({ address, uint32_t(getBranchTarget(flow, word, address)), XrefKind::Call });
+				break;
+
+			case Flow::Jump:
+			case Flow::CallIndirect:
+				if (known & (1u << inst.field0))
+				{
+					// braf and bsrf are relative to the branch + 4
+					const bool relative = mnemonicIs(Decoder::instructions[inst.id].decodeString, "braf") || mnemonicIs(Decoder::instructions[inst.id].decodeString, "bsrf");
+					const uint32_t target = values[inst.field0] + (relative ? address + 4 : 0);
+
+					byFrom.push_back({ address, target, flow == Flow::Jump ? XrefKind::Jump : XrefKind::Call });
+				}
+				break;
+
+			default:
+				break;
+			}
+
+			const auto writes = uint32_t(getResources(inst).writes & 0xFFFF);
+			known &= ~writes;
+
+			if (literal != Literal::None)
+			{
+				const uint32_t pool = uint32_t(getLiteralAddress(literal, word, address));
+				uint64_t position{};
+
+				if (literal == Literal::Address)
+				{
+					byFrom.push_back({ address, pool, XrefKind::Address });
+				}
+				else
+				{
+					byFrom.push_back({ address, pool, XrefKind::Read });
+
+					// the constant is only known if the pool is in the image
+					if (view.getPosition(pool, position) && view.contains(position + (literal == Literal::Long ? 2 : 0)))
+					{
+						const uint32_t value = literal == Literal::Long ?
+							view.getWord(position) | (uint32_t(view.getWord(position + 2)) << 16) :
+							uint32_t(int16_t(view.getWord(position)));
+
+						byFrom.push_back({ address, value, XrefKind::Constant });
+
+						known |= 1u << inst.field1;
+						values[inst.field1] = value;
+					}
+				}
+			}
+
+			// whatever follows a branch can be reached with anything in the registers
+			if (flow != Flow::None)
+				known = 0;
+		}
+
+		sort();
+	}
+
+	void sort()
+	{
+		std::sort(byFrom.begin(), byFrom.end(), [](const Xref& a, const Xref& b) { return a.from != b.from ? a.from < b.from : a.to < b.to; });
+
+		byTo = byFrom;
+		std::sort(byTo.begin(), byTo.end(), [](const Xref& a, const Xref& b) { return a.to != b.to ? a.to < b.to : a.from < b.from; });
+	}
+
+	// everything that points at 'address', like who calls a function or loads an MMIO register
+	std::span<const Xref> getRefsTo(uint32_t address) const
+	{
+		const auto [first, last] = std::equal_range(byTo.begin(), byTo.end(), Xref{ 0, address }, [](const Xref& a, const Xref& b) { return a.to < b.to; });
+		return { first, last };
+	}
+
+	// everything the instruction at 'address' points at
+	std::span<const Xref> getRefsFrom(uint32_t address) const
+	{
+		const auto [first, last] = std::equal_range(byFrom.begin(), byFrom.end(), Xref{ address }, [](const Xref& a, const Xref& b) { return a.from < b.from; });
+		return { first, last };
+	}
+
+	// only 'byFrom' is written, the other order is rebuilt on load. the count
+	// has to match the file and what 'view' could hold before it's allocated
+	bool load(const std::string& path, const ImageView& view)
+	{
+		auto* file = fopen(path.c_str(), "rb");
+
+		if (!file)
+			return false;
+
+		const Header expected{};
+		uint64_t fileSize{};
+		bool ok =
+			getFileSize(file, fileSize) &&
+			seekFile(file, 0) &&
+			fread(&header, sizeof(header), 1, file) == 1 &&
+			!memcmp(header.magic, expected.magic, sizeof(header.magic)) &&
+			header.formatVersion == expected.formatVersion &&
+			header.offset == view.offset &&
+			header.wordCount == view.words.size() &&
+			header.count <= header.wordCount * maxRefsPerWord &&
+			header.count == (fileSize - sizeof(header)) / sizeof(Xref) &&
+			(fileSize - sizeof(header)) % sizeof(Xref) == 0;
+
+		if (ok)
+		{
+			byFrom.resize(size_t(header.count));
+			ok = fread(byFrom.data(), sizeof(Xref), byFrom.size(), file) == byFrom.size();
+		}
+
+		fclose(file);
+
+		if (ok)
+		{
+			byTo = byFrom;
+			std::sort(byTo.begin(), byTo.end(), [](const Xref& a, const Xref& b) { return a.to != b.to ? a.to < b.to : a.from < b.from; });
+		}
+
+		return ok;
+	}
+
+	bool save(const std::string& path)
+	{
+		auto* file = fopen(path.c_str(), "wb");
+
+		if (!file)
+			return false;
+
+		header.count = byFrom.size();
+
+		const bool ok =
+			fwrite(&header, sizeof(header), 1, file) == 1 &&
+			fwrite(byFrom.data(), sizeof(Xref), byFrom.size(), file) == byFrom.size();
+
+		fclose(file);
+
+		return ok;
+	}
+};
+
+static_assert(sizeof(Xref) == 12, "Xref is written to disk as is");